@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <exec/single_thread_context.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+#include <zephyr/execution/strandScheduler.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t POOL_THREADS = 4;
+constexpr std::size_t TASKS_PER_PRODUCER = 10000;
+
+// Every producer thread schedules TASKS_PER_PRODUCER tiny tasks onto one strand; an iteration
+// ends once the strand has run all of them
+auto strandThroughput(benchmark::State& t_state) -> void
+{
+    const auto producers = static_cast<std::size_t>(t_state.range(0));
+    const auto total = producers * TASKS_PER_PRODUCER;
+
+    exec::static_thread_pool pool(POOL_THREADS);
+    zephyr::execution::StrandScheduler strand(pool.get_scheduler());
+    std::atomic<std::size_t> completed{0};
+
+    for (auto _ : t_state) {
+        completed.store(0, std::memory_order_relaxed);
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(producers);
+
+            for (std::size_t producer = 0; producer < producers; ++producer) {
+                threads.emplace_back([&strand, &completed, total] {
+                    const auto task = [&completed, total] {
+                        if (completed.fetch_add(1, std::memory_order_acq_rel) + 1 == total) {
+                            completed.notify_one();
+                        }
+                    };
+
+                    for (std::size_t i = 0; i < TASKS_PER_PRODUCER; ++i) {
+                        stdexec::start_detached(stdexec::schedule(strand) | stdexec::then(task));
+                    }
+                });
+            }
+        }
+
+        for (auto current = completed.load(std::memory_order_acquire); current != total;
+             current = completed.load(std::memory_order_acquire)) {
+            completed.wait(current, std::memory_order_acquire);
+        }
+    }
+
+    t_state.SetItemsProcessed(static_cast<int64_t>(t_state.iterations() * total));
+}
+
+// What a connection costs before it does anything: one round trip through its own execution
+// context, for t_state.range(0) connections alive at once. A thread per connection against a
+// strand per connection over one shared pool.
+template<typename Context>
+auto connectionContexts(benchmark::State& t_state, auto t_make) -> void
+{
+    const auto connections = static_cast<std::size_t>(t_state.range(0));
+    std::atomic<std::size_t> completed{0};
+
+    for (auto _ : t_state) {
+        completed.store(0, std::memory_order_relaxed);
+
+        std::vector<std::unique_ptr<Context>> contexts;
+        contexts.reserve(connections);
+        for (std::size_t i = 0; i < connections; ++i) {
+            contexts.push_back(t_make());
+            stdexec::start_detached(stdexec::schedule(contexts.back()->scheduler()) | stdexec::then([&completed, connections] {
+                if (completed.fetch_add(1, std::memory_order_acq_rel) + 1 == connections) {
+                    completed.notify_one();
+                }
+            }));
+        }
+
+        for (auto current = completed.load(std::memory_order_acquire); current != connections;
+             current = completed.load(std::memory_order_acquire)) {
+            completed.wait(current, std::memory_order_acquire);
+        }
+    }
+
+    t_state.SetItemsProcessed(static_cast<int64_t>(t_state.iterations() * connections));
+}
+
+struct ThreadPerConnection
+{
+    exec::single_thread_context context;
+
+    auto scheduler() { return context.get_scheduler(); }
+};
+
+struct StrandPerConnection
+{
+    zephyr::execution::StrandScheduler<exec::static_thread_pool::scheduler> strand;
+
+    auto scheduler() { return strand; }
+};
+
+auto threadPerConnection(benchmark::State& t_state) -> void
+{
+    connectionContexts<ThreadPerConnection>(t_state, [] { return std::make_unique<ThreadPerConnection>(); });
+}
+
+auto strandPerConnection(benchmark::State& t_state) -> void
+{
+    exec::static_thread_pool pool(POOL_THREADS);
+    connectionContexts<StrandPerConnection>(t_state, [&pool] {
+        return std::make_unique<StrandPerConnection>(StrandPerConnection{zephyr::execution::StrandScheduler{pool.get_scheduler()}});
+    });
+}
+}  // namespace
+
+BENCHMARK(strandThroughput)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(threadPerConnection)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(strandPerConnection)->Arg(100)->Arg(1000)->Arg(20000)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/http/details/delimiterScanner.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::http::details;
+
+// Header block of a typical browser request; splitting it into lines is the parser's hot loop
+const std::string HEADERS = "Host: api.example.com\r\n"
+                            "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:128.0) Gecko/20100101 Firefox/128.0\r\n"
+                            "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+                            "Accept-Language: en-US,en;q=0.5\r\n"
+                            "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+                            "Referer: https://example.com/some/rather/long/path/to/a/page.html\r\n"
+                            "Connection: keep-alive\r\n"
+                            "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; lang=en\r\n"
+                            "Upgrade-Insecure-Requests: 1\r\n"
+                            "\r\n";
+
+// What the parser did before: find each line end, then the colon inside the line
+auto stringFind(benchmark::State& t_state) -> void
+{
+    const std::string_view headers = HEADERS;
+
+    for (auto _ : t_state) {
+        std::size_t delimiters = 0;
+        for (std::size_t pos = 0, end = 0; (end = headers.find('\n', pos)) != std::string_view::npos; pos = end + 1) {
+            delimiters += headers.substr(pos, end - pos).find(':') != std::string_view::npos ? 2 : 1;
+        }
+        benchmark::DoNotOptimize(delimiters);
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * HEADERS.size()));
+}
+
+// One pass indexing every line end and colon of the block
+auto scannerIndex(benchmark::State& t_state, ScannerKind t_kind) -> void
+{
+    const auto scan = scanner_for(t_kind);
+    if (scan == nullptr) {
+        t_state.SkipWithError("scanner not supported on this CPU");
+        return;
+    }
+
+    std::array<uint32_t, 64> out{};
+
+    for (auto _ : t_state) {
+        std::size_t delimiters = 0;
+        for (std::size_t from = 0; from < HEADERS.size();) {
+            auto [count, scanned] = scan(HEADERS.data(), from, HEADERS.size(), ':', '\n', out);
+            delimiters += count;
+            from = scanned;
+        }
+        benchmark::DoNotOptimize(delimiters);
+        benchmark::DoNotOptimize(out);
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * HEADERS.size()));
+}
+}  // namespace
+
+BENCHMARK(stringFind);
+BENCHMARK_CAPTURE(scannerIndex, scalar, ScannerKind::scalar);
+BENCHMARK_CAPTURE(scannerIndex, sse2, ScannerKind::sse2);
+BENCHMARK_CAPTURE(scannerIndex, avx2, ScannerKind::avx2);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/http/httpParser.hpp>
+
+#include <string>
+
+namespace
+{
+using namespace zephyr::http;
+
+const std::string SMALL_REQUEST = "GET / HTTP/1.1\r\n"
+                                  "Host: localhost\r\n"
+                                  "\r\n";
+
+const std::string TYPICAL_REQUEST = "POST /api/v1/users/42/orders?limit=10 HTTP/1.1\r\n"
+                                    "Host: api.example.com\r\n"
+                                    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Gecko/20100101 Firefox/128.0\r\n"
+                                    "Accept: application/json\r\n"
+                                    "Accept-Encoding: gzip, deflate, br\r\n"
+                                    "Accept-Language: en-US,en;q=0.5\r\n"
+                                    "Connection: keep-alive\r\n"
+                                    "Content-Type: application/json\r\n"
+                                    "Content-Length: 27\r\n"
+                                    "\r\n"
+                                    "{\"item\":\"book\",\"count\":3}\r\n";
+
+auto httpParserParse(benchmark::State& t_state, const std::string& t_raw) -> void
+{
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(HttpParser::parse(t_raw));
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * t_raw.size()));
+}
+
+// Zero-copy path used by the pipelines: views into the buffer, no HttpRequest materialized
+auto httpParserFeed(benchmark::State& t_state, const std::string& t_raw) -> void
+{
+    HttpParser parser;
+
+    for (auto _ : t_state) {
+        parser.reset();
+        benchmark::DoNotOptimize(parser.feed(t_raw));
+        benchmark::DoNotOptimize(parser.request());
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * t_raw.size()));
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(httpParserParse, small, SMALL_REQUEST);
+BENCHMARK_CAPTURE(httpParserParse, typical, TYPICAL_REQUEST);
+BENCHMARK_CAPTURE(httpParserFeed, small, SMALL_REQUEST);
+BENCHMARK_CAPTURE(httpParserFeed, typical, TYPICAL_REQUEST);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/details/radixTree.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpRouter.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace
+{
+using namespace zephyr::http;
+
+constexpr std::size_t ROUTE_COUNT = 300;
+
+auto okHandler(const HttpRequest& /*unused*/, const zephyr::context::Context& /*unused*/) -> HttpResponse
+{
+    return HttpResponse::ok("ok");
+}
+
+auto makeRouter() -> HttpRouter
+{
+    HttpRouter router;
+    for (std::size_t i = 0; i < ROUTE_COUNT; ++i) {
+        router.get("/api/v1/resource" + std::to_string(i) + "/:id", okHandler);
+    }
+
+    return router;
+}
+
+auto radixTreeFind(benchmark::State& t_state) -> void
+{
+    zephyr::http::details::RadixTree tree;
+    for (std::size_t i = 0; i < ROUTE_COUNT; ++i) {
+        tree.insert("GET", "/api/v1/resource" + std::to_string(i) + "/:id", i);
+    }
+    tree.insert("GET", "/users/:id/orders/:order", ROUTE_COUNT);
+
+    const std::string path = "/users/42/orders/1337";
+    zephyr::http::details::RouteMatch match;
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(tree.find("GET", path, match));
+    }
+}
+
+// Lookup cost no longer depends on where the route was registered
+auto httpRouterRoute(benchmark::State& t_state) -> void
+{
+    const auto router = makeRouter();
+
+    HttpRequest request;
+    request.method = "GET";
+    request.path = "/api/v1/resource" + std::to_string(t_state.range(0)) + "/42";
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(router.route(request));
+    }
+}
+
+auto httpRouterNotFound(benchmark::State& t_state) -> void
+{
+    const auto router = makeRouter();
+
+    HttpRequest request;
+    request.method = "GET";
+    request.path = "/missing";
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(router.route(request));
+    }
+}
+}  // namespace
+
+BENCHMARK(radixTreeFind);
+BENCHMARK(httpRouterRoute)->Arg(0)->Arg(ROUTE_COUNT - 1);
+BENCHMARK(httpRouterNotFound);
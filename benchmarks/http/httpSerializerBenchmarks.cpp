@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpSerializer.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace
+{
+using namespace zephyr::http;
+
+auto makeResponse(std::string t_body) -> HttpResponse
+{
+    auto response = HttpResponse::json(std::move(t_body));
+    response.headers["Cache-Control"] = "no-cache";
+    response.headers["Server"] = "zephyr";
+    return response;
+}
+
+auto httpSerializerSerialize(benchmark::State& t_state) -> void
+{
+    const auto response = makeResponse(std::string(static_cast<std::size_t>(t_state.range(0)), 'x'));
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(HttpSerializer::serialize(response));
+    }
+}
+
+// Both variants build the response per iteration, as a handler does; only the serialization differs
+auto httpSerializerFlatFromHandler(benchmark::State& t_state) -> void
+{
+    const std::string body(static_cast<std::size_t>(t_state.range(0)), 'x');
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(HttpSerializer::serialize(makeResponse(body)));
+    }
+}
+
+auto httpSerializerVectoredFromHandler(benchmark::State& t_state) -> void
+{
+    const std::string body(static_cast<std::size_t>(t_state.range(0)), 'x');
+
+    for (auto _ : t_state) {
+        auto output = HttpSerializer::serialize_vectored(makeResponse(body));
+        benchmark::DoNotOptimize(output.vectors());
+    }
+}
+}  // namespace
+
+BENCHMARK(httpSerializerSerialize)->Arg(16)->Arg(1024)->Arg(16384);
+BENCHMARK(httpSerializerFlatFromHandler)->Arg(16)->Arg(1024)->Arg(16384)->Arg(1 << 20);
+BENCHMARK(httpSerializerVectoredFromHandler)->Arg(16)->Arg(1024)->Arg(16384)->Arg(1 << 20);
@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/staticFiles.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace zephyr::http;
+namespace fs = std::filesystem;
+
+// A file of t_size bytes in a fresh directory, and a socket whose peer is drained by a thread, so
+// the cost measured is getting the file onto the socket
+class Fixture
+{
+public:
+    explicit Fixture(std::size_t t_size)
+    {
+        std::string pattern = (fs::temp_directory_path() / "zephyr-bench-XXXXXX").string();
+        m_dir = ::mkdtemp(pattern.data());
+        m_file = (m_dir / "file.bin").string();
+        std::ofstream{m_file, std::ios::binary} << std::string(t_size, 'x');
+
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+            throw std::runtime_error("socketpair failed");
+        }
+        m_socket = fds[0];
+        m_peer = fds[1];
+
+        m_drain = std::thread([this] {
+            char buffer[64 * 1024];
+            while (::read(m_peer, buffer, sizeof(buffer)) > 0) {
+            }
+        });
+    }
+
+    ~Fixture()
+    {
+        ::shutdown(m_socket, SHUT_RDWR);
+        m_drain.join();
+        ::close(m_socket);
+        ::close(m_peer);
+        fs::remove_all(m_dir);
+    }
+
+    auto dir() const -> std::string { return m_dir.string(); }
+    auto file() const -> const std::string& { return m_file; }
+    auto socket() const -> int { return m_socket; }
+
+private:
+    fs::path m_dir;
+    std::string m_file;
+    int m_socket = -1;
+    int m_peer = -1;
+    std::thread m_drain;
+};
+
+auto write_all(int t_fd, const char* t_data, std::size_t t_size) -> void
+{
+    while (t_size > 0) {
+        auto written = ::write(t_fd, t_data, t_size);
+        if (written <= 0) {
+            std::abort();
+        }
+        t_data += written;
+        t_size -= static_cast<std::size_t>(written);
+    }
+}
+
+// What a handler without file support does: open, read the whole file into the body, copy it out
+auto staticFilesReadIntoString(benchmark::State& t_state) -> void
+{
+    const auto size = static_cast<std::size_t>(t_state.range(0));
+    Fixture fixture{size};
+
+    for (auto _ : t_state) {
+        std::ifstream in{fixture.file(), std::ios::binary};
+        std::string body(size, '\0');
+        in.read(body.data(), static_cast<std::streamsize>(size));
+        write_all(fixture.socket(), body.data(), body.size());
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * size));
+}
+
+// The session's path for a file body: cached descriptor, spliced into a pipe and from there into
+// the socket, without the bytes passing through user space
+auto staticFilesSplice(benchmark::State& t_state) -> void
+{
+    const auto size = static_cast<std::size_t>(t_state.range(0));
+    Fixture fixture{size};
+
+    const int file = ::open(fixture.file().c_str(), O_RDONLY | O_CLOEXEC);
+    int pipe[2];
+    if (file < 0 || ::pipe2(pipe, O_CLOEXEC) != 0) {
+        t_state.SkipWithError("cannot open the file or pipe");
+        return;
+    }
+    ::fcntl(pipe[1], F_SETPIPE_SZ, 1024 * 1024);
+
+    for (auto _ : t_state) {
+        loff_t offset = 0;
+        std::size_t left = size;
+        while (left > 0) {
+            auto in_pipe = ::splice(file, &offset, pipe[1], nullptr, left, SPLICE_F_MOVE);
+            if (in_pipe <= 0) {
+                std::abort();
+            }
+            left -= static_cast<std::size_t>(in_pipe);
+            while (in_pipe > 0) {
+                auto sent = ::splice(pipe[0], nullptr, fixture.socket(), nullptr, static_cast<std::size_t>(in_pipe), SPLICE_F_MOVE);
+                if (sent <= 0) {
+                    std::abort();
+                }
+                in_pipe -= sent;
+            }
+        }
+    }
+
+    t_state.SetBytesProcessed(static_cast<int64_t>(t_state.iterations() * size));
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+    ::close(file);
+}
+
+// The handler alone on an open-file cache hit: no file system call, no copy of the content
+auto staticFilesHandlerHit(benchmark::State& t_state) -> void
+{
+    Fixture fixture{static_cast<std::size_t>(t_state.range(0))};
+    fs::rename(fixture.file(), fixture.dir() + "/index.html");
+
+    const StaticFiles files{"/static", fixture.dir(), {.revalidate_after = std::chrono::hours{1}}};
+    const zephyr::context::Context context;
+
+    HttpRequest request;
+    request.method = "GET";
+    request.path = "/static/index.html";
+    request.version = "HTTP/1.1";
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(files(request, context));
+    }
+}
+}  // namespace
+
+BENCHMARK(staticFilesReadIntoString)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(staticFilesSplice)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(staticFilesHandlerHit)->Arg(4 << 10);
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+#include <stdexec/execution.hpp>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpRouter.hpp>
+#include <zephyr/http/staticRouter.hpp>
+
+#include <string>
+#include <utility>
+
+namespace
+{
+using namespace zephyr::http;
+using zephyr::context::Context;
+
+auto okHandler(const HttpRequest& /*unused*/, const Context& /*unused*/) -> HttpResponse
+{
+    return HttpResponse::ok("ok");
+}
+
+// The same table for both routers, so the numbers compare lookup and dispatch only
+const StaticRouter STATIC_ROUTER{
+    route<"GET", "/">(okHandler),
+    route<"GET", "/health">(okHandler),
+    route<"GET", "/api/v1/users">(okHandler),
+    route<"POST", "/api/v1/users">(okHandler),
+    route<"GET", "/api/v1/users/me">(okHandler),
+    route<"GET", "/api/v1/orders">(okHandler),
+    route<"POST", "/api/v1/orders">(okHandler),
+    route<"GET", "/api/v1/products">(okHandler),
+    route<"GET", "/api/v1/users/:id">(okHandler),
+    route<"GET", "/api/v1/users/:id/orders/:order">(okHandler),
+    route<"GET", "/static/*">(okHandler),
+};
+
+auto makeRuntimeRouter() -> HttpRouter
+{
+    HttpRouter router;
+    router.get("/", okHandler);
+    router.get("/health", okHandler);
+    router.get("/api/v1/users", okHandler);
+    router.post("/api/v1/users", okHandler);
+    router.get("/api/v1/users/me", okHandler);
+    router.get("/api/v1/orders", okHandler);
+    router.post("/api/v1/orders", okHandler);
+    router.get("/api/v1/products", okHandler);
+    router.get("/api/v1/users/:id", okHandler);
+    router.get("/api/v1/users/:id/orders/:order", okHandler);
+    router.get("/static/*", okHandler);
+    return router;
+}
+
+auto makeRequest(std::string t_method, std::string t_path) -> HttpRequest
+{
+    HttpRequest request;
+    request.method = std::move(t_method);
+    request.path = std::move(t_path);
+    return request;
+}
+
+auto staticRouterExact(benchmark::State& t_state) -> void
+{
+    const Context context;
+    const auto request = makeRequest("GET", "/api/v1/products");
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(STATIC_ROUTER.route(request, context));
+    }
+}
+
+auto staticRouterParams(benchmark::State& t_state) -> void
+{
+    const Context context;
+    const auto request = makeRequest("GET", "/api/v1/users/42/orders/1337");
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(STATIC_ROUTER.route(request, context));
+    }
+}
+
+auto staticRouterNotFound(benchmark::State& t_state) -> void
+{
+    const Context context;
+    const auto request = makeRequest("GET", "/missing");
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(STATIC_ROUTER.route(request, context));
+    }
+}
+
+// The runtime router hands back a type-erased sender; it is run to completion to get the response
+auto runtimeRouterExact(benchmark::State& t_state) -> void
+{
+    const auto router = makeRuntimeRouter();
+    const auto request = makeRequest("GET", "/api/v1/products");
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(stdexec::sync_wait(router.route(request)));
+    }
+}
+
+auto runtimeRouterParams(benchmark::State& t_state) -> void
+{
+    const auto router = makeRuntimeRouter();
+    const auto request = makeRequest("GET", "/api/v1/users/42/orders/1337");
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(stdexec::sync_wait(router.route(request)));
+    }
+}
+}  // namespace
+
+BENCHMARK(staticRouterExact);
+BENCHMARK(staticRouterParams);
+BENCHMARK(staticRouterNotFound);
+BENCHMARK(runtimeRouterExact);
+BENCHMARK(runtimeRouterParams);
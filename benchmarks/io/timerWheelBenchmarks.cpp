@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/io/timerWheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+using zephyr::io::ExpiredTimer;
+using zephyr::io::TimerNode;
+using zephyr::io::TimerWheel;
+using namespace std::chrono_literals;
+
+const auto start = TimerWheel::Clock::time_point{} + 1h;
+
+// Deadlines spread like idle timeouts set at different times
+auto deadlines(std::size_t t_count) -> std::vector<std::chrono::milliseconds>
+{
+    std::mt19937 random{7};
+    std::uniform_int_distribution<int64_t> spread{1'000, 120'000};
+
+    std::vector<std::chrono::milliseconds> result(t_count);
+    for (auto& deadline : result) {
+        deadline = std::chrono::milliseconds{spread(random)};
+    }
+    return result;
+}
+
+// A session moving its deadline on every read, with t_state.range(0) other timers in the wheel
+auto timerWheelReschedule(benchmark::State& t_state) -> void
+{
+    const auto count = static_cast<std::size_t>(t_state.range(0));
+    const auto spread = deadlines(count);
+
+    TimerWheel wheel{1ms, start};
+    std::vector<TimerNode> nodes(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        wheel.schedule(nodes[i], start + spread[i]);
+    }
+
+    std::size_t next = 0;
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(wheel.schedule(nodes[next], start + spread[(next + 1) % count]));
+        next = (next + 1) % count;
+    }
+}
+
+// The same with an ordered multimap, the usual timer queue
+auto multimapReschedule(benchmark::State& t_state) -> void
+{
+    using Queue = std::multimap<TimerWheel::Clock::time_point, std::size_t>;
+
+    const auto count = static_cast<std::size_t>(t_state.range(0));
+    const auto spread = deadlines(count);
+
+    Queue queue;
+    std::vector<Queue::iterator> positions(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        positions[i] = queue.emplace(start + spread[i], i);
+    }
+
+    std::size_t next = 0;
+    for (auto _ : t_state) {
+        queue.erase(positions[next]);
+        positions[next] = queue.emplace(start + spread[(next + 1) % count], next);
+        benchmark::DoNotOptimize(positions[next]);
+        next = (next + 1) % count;
+    }
+}
+
+// Fires t_state.range(0) timers spread over two minutes, one wakeup at a time
+auto timerWheelExpire(benchmark::State& t_state) -> void
+{
+    const auto count = static_cast<std::size_t>(t_state.range(0));
+    const auto spread = deadlines(count);
+    std::vector<TimerNode> nodes(count);
+    std::vector<ExpiredTimer> expired;
+    expired.reserve(count);
+
+    for (auto _ : t_state) {
+        TimerWheel wheel{1ms, start};
+        for (std::size_t i = 0; i < count; ++i) {
+            wheel.schedule(nodes[i], start + spread[i]);
+        }
+
+        while (auto wakeup = wheel.next_wakeup()) {
+            wheel.advance(*wakeup, expired);
+        }
+        benchmark::DoNotOptimize(expired.data());
+        expired.clear();
+    }
+
+    t_state.SetItemsProcessed(t_state.iterations() * static_cast<int64_t>(count));
+}
+}  // namespace
+
+BENCHMARK(timerWheelReschedule)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(multimapReschedule)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(timerWheelExpire)->Arg(100'000);
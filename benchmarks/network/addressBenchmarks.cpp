@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/network/addressV4.hpp>
+#include <zephyr/network/addressV6.hpp>
+
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::network;
+
+constexpr std::string_view V4_TEXT = "192.168.100.254";
+constexpr std::string_view V6_TEXT = "2001:db8:85a3::8a2e:370:7334";
+
+auto addressV4FromString(benchmark::State& t_state) -> void
+{
+    for (auto _ : t_state) {
+        auto text = V4_TEXT;
+        benchmark::DoNotOptimize(text);
+        benchmark::DoNotOptimize(AddressV4::fromString(text));
+    }
+}
+
+auto addressV4ToString(benchmark::State& t_state) -> void
+{
+    const auto address = *AddressV4::fromString(V4_TEXT);
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(address.toString());
+    }
+}
+
+auto addressV6FromString(benchmark::State& t_state) -> void
+{
+    for (auto _ : t_state) {
+        auto text = V6_TEXT;
+        benchmark::DoNotOptimize(text);
+        benchmark::DoNotOptimize(AddressV6::fromString(text));
+    }
+}
+
+auto addressV6ToString(benchmark::State& t_state) -> void
+{
+    const auto address = *AddressV6::fromString(V6_TEXT);
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(address.toString());
+    }
+}
+}  // namespace
+
+BENCHMARK(addressV4FromString);
+BENCHMARK(addressV4ToString);
+BENCHMARK(addressV6FromString);
+BENCHMARK(addressV6ToString);
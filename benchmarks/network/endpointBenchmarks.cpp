@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <zephyr/network/endpoint.hpp>
+
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::network;
+
+constexpr std::string_view V4_ENDPOINT = "192.168.1.1:8080";
+constexpr std::string_view V6_ENDPOINT = "[2001:db8::1]:8080";
+
+auto endpointFromString(benchmark::State& t_state, std::string_view t_text) -> void
+{
+    for (auto _ : t_state) {
+        auto text = t_text;
+        benchmark::DoNotOptimize(text);
+        benchmark::DoNotOptimize(TcpEndpoint::fromString(text));
+    }
+}
+
+auto endpointToString(benchmark::State& t_state, std::string_view t_text) -> void
+{
+    const auto endpoint = *TcpEndpoint::fromString(t_text);
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(endpoint.toString());
+    }
+}
+
+auto endpointToSockaddr(benchmark::State& t_state, std::string_view t_text) -> void
+{
+    auto endpoint = *TcpEndpoint::fromString(t_text);
+
+    for (auto _ : t_state) {
+        benchmark::DoNotOptimize(endpoint);
+        benchmark::DoNotOptimize(endpoint.toSockaddr());
+    }
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(endpointFromString, v4, V4_ENDPOINT);
+BENCHMARK_CAPTURE(endpointFromString, v6, V6_ENDPOINT);
+BENCHMARK_CAPTURE(endpointToString, v4, V4_ENDPOINT);
+BENCHMARK_CAPTURE(endpointToString, v6, V6_ENDPOINT);
+BENCHMARK_CAPTURE(endpointToSockaddr, v4, V4_ENDPOINT);
+BENCHMARK_CAPTURE(endpointToSockaddr, v6, V6_ENDPOINT);
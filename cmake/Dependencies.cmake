@@ -20,6 +20,19 @@ if(Catch2_SOURCE_DIR)
 endif()
 find_package(Catch2 3 CONFIG REQUIRED)
 
+# Google Benchmark - only needed for the microbenchmark suite
+if(ZEPHYR_BUILD_BENCHMARKS)
+    CPMAddPackage(
+        NAME benchmark
+        GITHUB_REPOSITORY google/benchmark
+        VERSION 1.9.1
+        OPTIONS
+            "BENCHMARK_ENABLE_TESTING OFF"
+            "BENCHMARK_ENABLE_INSTALL OFF"
+            "BENCHMARK_ENABLE_GTEST_TESTS OFF"
+    )
+endif()
+
 # stdexec - C++ Senders/Receivers implementation
 CPMAddPackage(
     NAME stdexec
@@ -76,6 +76,11 @@ int main()
     auto echo_io = std::make_shared<zephyr::io::IoUringContext>();
     auto udp_io = std::make_shared<zephyr::io::IoUringContext>();
 
+    // Each context reaps its completions on a dedicated reactor thread until it is stopped
+    std::jthread http_reactor([http_io] { http_io->run(); });
+    std::jthread echo_reactor([echo_io] { echo_io->run(); });
+    std::jthread udp_reactor([udp_io] { udp_io->run(); });
+
     // HTTP Server (TCP + HTTP Pipeline) - using HttpPipelineBuilder with middlewares
     auto http_pipeline_factory =
         zephyr::http::HttpPipelineBuilder<>()
@@ -96,7 +101,9 @@ int main()
         scheduler,
         []() {
             return zephyr::pipelines::make_raw_pipeline<zephyr::tcp::TcpProtocol>(
-                [](std::string data) -> zephyr::tcp::TcpProtocol::OutputType { return "ECHO: " + data; });
+                [](zephyr::tcp::TcpProtocol::InputType data) -> zephyr::tcp::TcpProtocol::OutputType {
+                    return "ECHO: " + std::string(data.view());
+                });
         },
         echo_io);
 
@@ -127,6 +134,10 @@ int main()
     echo_server.stop();
     udp_server.stop();
 
+    // The TCP servers only close their own connections; the reactors run until their contexts stop
+    http_io->stop();
+    echo_io->stop();
+
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     pool.request_stop();
 
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/common/rendezvous.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using zephyr::common::Rendezvous;
+}
+
+TEST_CASE("Rendezvous - hand-over", "[common][rendezvous]")
+{
+    Rendezvous<std::string> channel;
+    std::vector<std::string> received;
+    auto resumed = 0;
+
+    auto consume = [&received](std::exception_ptr t_error, std::optional<std::string> t_value) {
+        REQUIRE_FALSE(t_error);
+        received.push_back(std::move(*t_value));
+    };
+
+    SECTION("The producer resumes only once the value is taken")
+    {
+        channel.push("a", [&resumed] { ++resumed; });
+        REQUIRE(resumed == 0);
+
+        channel.pull(consume);
+        REQUIRE(resumed == 1);
+        REQUIRE(received == std::vector<std::string>{"a"});
+    }
+
+    SECTION("A waiting consumer gets the value immediately")
+    {
+        channel.pull(consume);
+        REQUIRE(received.empty());
+
+        channel.push("b", [&resumed] { ++resumed; });
+        REQUIRE(resumed == 1);
+        REQUIRE(received == std::vector<std::string>{"b"});
+    }
+
+    SECTION("Failing reaches the waiting and later consumers")
+    {
+        auto errors = 0;
+        auto expect_error = [&errors](std::exception_ptr t_error, std::optional<std::string> t_value) {
+            REQUIRE(t_error);
+            REQUIRE_FALSE(t_value);
+            ++errors;
+        };
+
+        channel.pull(expect_error);
+        channel.fail(std::make_exception_ptr(std::runtime_error("closed")));
+        channel.pull(expect_error);
+        REQUIRE(errors == 2);
+    }
+
+    SECTION("Abandoning releases the producer")
+    {
+        channel.push("c", [&resumed] { ++resumed; });
+        channel.abandon();
+        REQUIRE(resumed == 1);
+
+        channel.push("d", [&resumed] { ++resumed; });
+        REQUIRE(resumed == 2);
+    }
+}
+
+TEST_CASE("Rendezvous - across threads", "[common][rendezvous]")
+{
+    constexpr std::size_t count = 10000;
+    Rendezvous<int> channel;
+    std::vector<int> received;
+
+    // The producer pushes the next value from the resume callback, so it is never more than one ahead
+    std::function<void(int)> produce = [&](int t_next) {
+        if (static_cast<std::size_t>(t_next) < count) {
+            channel.push(t_next, [&produce, t_next] { produce(t_next + 1); });
+        }
+    };
+
+    std::thread producer([&produce] { produce(0); });
+
+    // The value may arrive on the producer thread; the counter orders it with the next pull
+    std::atomic<std::size_t> taken{0};
+    for (std::size_t i = 0; i < count; ++i) {
+        channel.pull([&](std::exception_ptr /*unused*/, std::optional<int> t_value) {
+            received.push_back(*t_value);
+            taken.store(received.size(), std::memory_order_release);
+        });
+        while (taken.load(std::memory_order_acquire) == i) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    REQUIRE(received.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+        REQUIRE(received[i] == static_cast<int>(i));
+    }
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/common/intrusivePtr.hpp>
+#include <zephyr/common/slab.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using zephyr::common::IntrusivePtr;
+using zephyr::common::Slab;
+
+struct Tracked
+{
+    explicit Tracked(std::string t_name, int& t_alive)
+        : name(std::move(t_name)), alive(t_alive)
+    {
+        if (name == "throws") {
+            throw std::runtime_error("construction failed");
+        }
+        ++alive;
+    }
+
+    ~Tracked() { --alive; }
+
+    std::string name;
+    int& alive;
+};
+
+// Counts like a session does and goes back to its slab with the last reference
+struct Counted
+{
+    explicit Counted(Slab<Counted, 4>& t_slab) : slab(t_slab) {}
+
+    void add_ref() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept
+    {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            slab.erase(this);
+        }
+    }
+
+    Slab<Counted, 4>& slab;
+    std::atomic<uint32_t> refs{1};
+};
+}
+
+TEST_CASE("Slab - slots and generations", "[common][slab]")
+{
+    int alive = 0;
+
+    {
+        Slab<Tracked, 2> slab;
+
+        auto [a, first] = slab.emplace("a", alive);
+        auto [b, second] = slab.emplace("b", alive);
+        REQUIRE(slab.size() == 2);
+        REQUIRE(slab.capacity() == 2);
+        REQUIRE(slab.get(a) == first);
+        REQUIRE(slab.get(b)->name == "b");
+
+        SECTION("A freed slot is reused, and the old key no longer finds anything")
+        {
+            slab.erase(a);
+            REQUIRE(alive == 1);
+            REQUIRE(slab.get(a) == nullptr);
+
+            auto [c, third] = slab.emplace("c", alive);
+            REQUIRE(third == first);
+            REQUIRE(c.index == a.index);
+            REQUIRE(c.generation != a.generation);
+            REQUIRE(slab.get(a) == nullptr);
+            REQUIRE(slab.get(c)->name == "c");
+            REQUIRE(slab.capacity() == 2);
+        }
+
+        SECTION("Pages are added when full and objects never move")
+        {
+            auto [c, third] = slab.emplace("c", alive);
+            REQUIRE(slab.capacity() == 4);
+            REQUIRE(slab.get(a) == first);
+            REQUIRE(slab.get(c) == third);
+            REQUIRE(slab.get(Slab<Tracked, 2>::Key{}) == nullptr);
+        }
+
+        SECTION("A constructor that throws leaves the slot free")
+        {
+            REQUIRE_THROWS(slab.emplace("throws", alive));
+            REQUIRE(slab.size() == 2);
+
+            slab.erase(second);
+            auto [c, third] = slab.emplace("c", alive);
+            REQUIRE(third == second);
+        }
+    }
+
+    // The slab destroys what is left in it
+    REQUIRE(alive == 0);
+}
+
+TEST_CASE("IntrusivePtr - reference counting", "[common][slab]")
+{
+    Slab<Counted, 4> slab;
+    auto [key, object] = slab.emplace(slab);
+
+    SECTION("The object goes back to its slab with the last reference")
+    {
+        auto owner = IntrusivePtr<Counted>::adopt(object);
+        IntrusivePtr<Counted> copy = owner;
+        REQUIRE(object->refs == 2);
+
+        owner = nullptr;
+        REQUIRE(slab.get(key) == object);
+
+        auto moved = std::move(copy);
+        REQUIRE_FALSE(copy);
+        moved.reset();
+        REQUIRE(slab.get(key) == nullptr);
+        REQUIRE(slab.size() == 0);
+    }
+
+    SECTION("References taken and dropped on several threads")
+    {
+        auto owner = IntrusivePtr<Counted>::adopt(object);
+
+        std::vector<std::jthread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&owner] {
+                for (int j = 0; j < 10000; ++j) {
+                    IntrusivePtr<Counted> copy{owner};
+                }
+            });
+        }
+        threads.clear();
+
+        REQUIRE(object->refs == 1);
+        owner.reset();
+        REQUIRE(slab.size() == 0);
+    }
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+#include <zephyr/common/callbackSender.hpp>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpPipelineWithMiddleware.hpp>
+#include <zephyr/http/httpRouter.hpp>
+#include <zephyr/http/middlewares/cacheMiddleware.hpp>
+#include <zephyr/http/responseCache.hpp>
+#include <zephyr/io/bufferRing.hpp>
+#include <zephyr/tcp/tcpProtocol.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace zephyr::http;
+using zephyr::common::Completion;
+using zephyr::common::from_callback;
+using zephyr::io::ProvidedBuffer;
+using zephyr::tcp::TcpProtocol;
+
+// GET /items answers only when the test says so, which keeps a miss in flight; POST /items
+// answers right away
+struct Backend
+{
+    std::size_t calls = 0;
+    std::vector<Completion<HttpResponse>> held;
+
+    auto answer(const std::string& t_body)
+        -> void
+    {
+        for (auto& done : std::exchange(held, {})) {
+            auto response = HttpResponse::ok(t_body);
+            response.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+            done(nullptr, std::move(response));
+        }
+    }
+
+    auto fail()
+        -> void
+    {
+        for (auto& done : std::exchange(held, {})) {
+            done(std::make_exception_ptr(std::runtime_error("backend down")), std::nullopt);
+        }
+    }
+};
+
+auto backend_router(const std::shared_ptr<Backend>& t_backend) -> std::unique_ptr<HttpRouter>
+{
+    auto router = std::make_unique<HttpRouter>();
+    router->get_async("/items", [t_backend](const HttpRequest&, const zephyr::context::Context&) {
+        ++t_backend->calls;
+        return from_callback<HttpResponse>([t_backend](Completion<HttpResponse> t_done) {
+            t_backend->held.push_back(std::move(t_done));
+        });
+    });
+    router->post("/items", [t_backend](const HttpRequest&, const zephyr::context::Context&) {
+        ++t_backend->calls;
+        return HttpResponse::ok("posted");
+    });
+    return router;
+}
+
+// One connection's pipeline: the cache in front of the router
+using CachedPipeline = HttpPipelineWithMiddleware<decltype(cache_middleware(nullptr))>;
+
+// What the connection writes for t_request; empty until it is done with it
+auto send(CachedPipeline& t_pipeline, std::string t_request)
+    -> std::shared_ptr<std::optional<std::string>>
+{
+    auto bytes = std::make_shared<std::string>(std::move(t_request));
+    auto written = std::make_shared<std::optional<std::string>>();
+    auto input = ProvidedBuffer::borrowed(std::as_writable_bytes(std::span{*bytes}));
+    stdexec::start_detached(t_pipeline(std::move(input), nullptr)
+                            | stdexec::then([bytes, written](TcpProtocol::OutputType t_output) {
+                                  *written = t_output ? t_output->data.flatten() : std::string{};
+                              }));
+    return written;
+}
+
+constexpr auto get_items = "GET /items HTTP/1.1\r\n\r\n";
+}
+
+TEST_CASE("Cache middleware - requests through the pipeline", "[http][cache_middleware]")
+{
+    auto backend = std::make_shared<Backend>();
+    auto router = backend_router(backend);
+    auto cache = std::make_shared<ResponseCache>(ResponseCacheOptions{.ttl = std::chrono::milliseconds{20}});
+
+    // Two connections sharing the cache
+    CachedPipeline first{*router, cache_middleware(cache)};
+    CachedPipeline second{*router, cache_middleware(cache)};
+
+    SECTION("Concurrent misses run the router once and a later request is a hit")
+    {
+        auto missed = send(first, get_items);
+        auto joined = send(second, get_items);
+        REQUIRE(backend->calls == 1);
+        REQUIRE_FALSE(*missed);
+        REQUIRE_FALSE(*joined);
+
+        backend->answer("items");
+        REQUIRE(*missed);
+        REQUIRE(*joined);
+        REQUIRE(**missed == **joined);
+        REQUIRE(missed->value().ends_with("items"));
+
+        auto hit = send(first, get_items);
+        REQUIRE(*hit);
+        REQUIRE(hit->value().find("Age: ") != std::string::npos);
+        REQUIRE(backend->calls == 1);
+    }
+
+    SECTION("An expired entry sends the next request to the router again")
+    {
+        send(first, get_items);
+        backend->answer("old");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{30});
+
+        auto refreshed = send(second, get_items);
+        REQUIRE(backend->calls == 2);
+        backend->answer("new");
+        REQUIRE(refreshed->value().ends_with("new"));
+    }
+
+    SECTION("Requests the cache may not answer bypass it")
+    {
+        auto posted = send(first, "POST /items HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+        auto again = send(second, "POST /items HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+        REQUIRE(backend->calls == 2);
+        REQUIRE(posted->value().ends_with("posted"));
+        REQUIRE(again->value().ends_with("posted"));
+
+        auto no_cache = send(first, "GET /items HTTP/1.1\r\nCache-Control: no-cache\r\n\r\n");
+        backend->answer("fresh");
+        REQUIRE(no_cache->value().ends_with("fresh"));
+        REQUIRE(cache->size() == 0);
+    }
+
+    SECTION("A failed miss sends the joined request to the router itself")
+    {
+        auto missed = send(first, get_items);
+        auto joined = send(second, get_items);
+
+        backend->fail();
+        REQUIRE(*missed);
+        REQUIRE_FALSE(*joined);
+        REQUIRE(backend->calls == 2);
+
+        backend->answer("retried");
+        REQUIRE(joined->value().ends_with("retried"));
+    }
+}
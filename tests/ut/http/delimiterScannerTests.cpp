@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/details/delimiterScanner.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+using namespace zephyr::http::details;
+
+// Collects every delimiter of [t_from, size) by resuming the scan, t_capacity offsets per call
+auto collect(IndexAnyFn t_scan, std::string_view t_data, std::size_t t_from, std::size_t t_capacity)
+    -> std::vector<uint32_t>
+{
+    std::vector<uint32_t> all;
+    std::vector<uint32_t> out(t_capacity);
+
+    while (true) {
+        auto [count, scanned] = t_scan(t_data.data(), t_from, t_data.size(), ':', '\n', out);
+        all.insert(all.end(), out.begin(), out.begin() + static_cast<std::ptrdiff_t>(count));
+        if (count < t_capacity) {
+            REQUIRE(scanned == t_data.size());
+            return all;
+        }
+
+        REQUIRE(scanned > out[count - 1]);
+        t_from = scanned;
+    }
+}
+}
+
+TEST_CASE("Delimiter scanner - every kind agrees with the scalar one", "[http][scanner]")
+{
+    const auto scalar = scanner_for(ScannerKind::scalar);
+    REQUIRE(scalar != nullptr);
+
+    for (auto kind : {ScannerKind::sse2, ScannerKind::avx2}) {
+        const auto scan = scanner_for(kind);
+        if (scan == nullptr) {
+            continue;
+        }
+
+        // Buffers that straddle the 16 and 32 byte block sizes, with delimiters in every position
+        for (std::size_t size = 0; size <= 80; ++size) {
+            for (std::size_t hit = 0; hit <= size; ++hit) {
+                std::string data(size, 'x');
+                for (auto i = hit; i < size; i += 7) {
+                    data[i] = i % 2 == 0 ? ':' : '\n';
+                }
+
+                for (std::size_t from : {std::size_t{0}, hit, size / 2}) {
+                    for (std::size_t capacity : {1, 3, 64}) {
+                        REQUIRE(collect(scan, data, from, capacity) == collect(scalar, data, from, capacity));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Delimiter scanner - index_any and find_any", "[http][scanner]")
+{
+    constexpr std::string_view LINES = "Content-Type: text/plain\r\nHost: localhost\r\n";
+
+    std::array<uint32_t, 8> out{};
+    auto [count, scanned] = index_any(LINES, 0, ':', '\n', out);
+
+    REQUIRE(count == 4);
+    REQUIRE(scanned == LINES.size());
+    REQUIRE(out[0] == LINES.find(':'));
+    REQUIRE(out[1] == LINES.find('\n'));
+    REQUIRE(out[2] == LINES.find(':', out[1]));
+    REQUIRE(out[3] == LINES.size() - 1);
+
+    REQUIRE(find_any(LINES, 13, ':', '\n') == LINES.find('\n'));
+    REQUIRE(find_any(LINES, 0, '#', '#') == std::string_view::npos);
+    REQUIRE(find_any(LINES, LINES.size(), '\n', '\n') == std::string_view::npos);
+    REQUIRE(find_any(LINES, LINES.size() + 5, '\n', '\n') == std::string_view::npos);
+    REQUIRE(find_any({}, 0, '\n', '\n') == std::string_view::npos);
+}
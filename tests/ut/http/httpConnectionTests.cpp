@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+#include <zephyr/common/callbackSender.hpp>
+#include <zephyr/common/rendezvous.hpp>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/httpBody.hpp>
+#include <zephyr/http/httpConnection.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpRouter.hpp>
+#include <zephyr/tcp/tcpProtocol.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+using namespace zephyr::http;
+using zephyr::common::Completion;
+using zephyr::common::Rendezvous;
+using zephyr::common::from_callback;
+using zephyr::tcp::TcpInputState;
+using zephyr::tcp::TcpProtocol;
+
+// An upload handler that reads only when the test says so and answers with the response the test
+// hands it; everything completes on the test's thread
+struct SlowUpload
+{
+    std::shared_ptr<HttpBodyReader> body;
+    std::shared_ptr<Rendezvous<HttpResponse>> response = std::make_shared<Rendezvous<HttpResponse>>();
+
+    // Takes the next piece of the body, nullopt once all of it has been read; an outer nullopt
+    // means the piece has not come in yet
+    auto read()
+        -> std::shared_ptr<std::optional<BodyChunk>>
+    {
+        auto chunk = std::make_shared<std::optional<BodyChunk>>();
+        stdexec::start_detached(body->next() | stdexec::then([chunk](BodyChunk t_chunk) { *chunk = std::move(t_chunk); }));
+        return chunk;
+    }
+};
+
+auto upload_router(const std::shared_ptr<SlowUpload>& t_upload) -> std::unique_ptr<HttpRouter>
+{
+    auto router = std::make_unique<HttpRouter>();
+    router->post_stream("/upload", [t_upload](const HttpRequest& t_request, const zephyr::context::Context&) {
+        t_upload->body = t_request.body_stream;
+        return from_callback<HttpResponse>([response = t_upload->response](Completion<HttpResponse> t_done) {
+            response->pull(std::move(t_done));
+        });
+    });
+    return router;
+}
+
+// Answers each path with its own name
+auto text_router() -> std::unique_ptr<HttpRouter>
+{
+    auto router = std::make_unique<HttpRouter>();
+    router->get("/a", [](const HttpRequest&, const zephyr::context::Context&) { return HttpResponse::ok("first"); });
+    router->get("/b", [](const HttpRequest&, const zephyr::context::Context&) { return HttpResponse::ok("second"); });
+    return router;
+}
+
+// The output of one read; empty until the connection is done with that read
+auto feed(HttpConnection& t_connection, std::string_view t_data, const HttpRouter& t_router)
+    -> std::shared_ptr<std::optional<TcpProtocol::OutputType>>
+{
+    auto output = std::make_shared<std::optional<TcpProtocol::OutputType>>();
+    auto handler = [&t_router](HttpRequest t_request) { return t_router.route(std::move(t_request)); };
+    stdexec::start_detached(t_connection(t_data, handler)
+                            | stdexec::then([output](TcpProtocol::OutputType t_output) { *output = std::move(t_output); }));
+    return output;
+}
+
+auto written(const TcpProtocol::OutputType& t_output) -> std::string
+{
+    return t_output ? t_output->data.flatten() : std::string{};
+}
+}
+
+TEST_CASE("HttpConnection - streamed request bodies", "[http][connection]")
+{
+    auto upload = std::make_shared<SlowUpload>();
+    auto router = upload_router(upload);
+    HttpConnection connection{*router};
+
+    auto first = feed(connection, "POST /upload HTTP/1.1\r\nContent-Length: 10\r\n\r\nhello", *router);
+    REQUIRE(upload->body);
+
+    SECTION("A read is done only once the handler has taken its part of the body")
+    {
+        REQUIRE_FALSE(*first);
+
+        auto hello = upload->read();
+        REQUIRE(hello->has_value());
+        REQUIRE(**hello == "hello");
+        REQUIRE(*first);
+        REQUIRE(written(**first).empty());
+        REQUIRE((**first)->awaiting == TcpInputState::body);
+
+        auto second = feed(connection, "world", *router);
+        REQUIRE_FALSE(*second);
+
+        auto world = upload->read();
+        REQUIRE(world->has_value());
+        REQUIRE(**world == "world");
+        REQUIRE_FALSE(*second);
+
+        // The end of the body goes through the channel too, then the response is awaited
+        auto end = upload->read();
+        REQUIRE(end->has_value());
+        REQUIRE_FALSE(**end);
+        REQUIRE_FALSE(*second);
+
+        upload->response->push(HttpResponse::ok("stored"), nullptr);
+        REQUIRE(*second);
+        REQUIRE(written(**second).starts_with("HTTP/1.1 200 OK\r\n"));
+        REQUIRE(written(**second).ends_with("stored"));
+        REQUIRE((**second)->awaiting == TcpInputState::idle);
+    }
+
+    SECTION("A handler that answers early lets the rest of the body through unread")
+    {
+        upload->response->push(HttpResponse::ok("too late"), nullptr);
+        REQUIRE(*first);
+
+        auto second = feed(connection, "world", *router);
+        REQUIRE(*second);
+        REQUIRE(written(**second).ends_with("too late"));
+    }
+}
+
+TEST_CASE("HttpConnection - keep-alive and pipelining", "[http][connection]")
+{
+    auto router = text_router();
+    HttpConnection connection{*router};
+
+    SECTION("Requests pipelined in one read are answered in order in one output")
+    {
+        auto output = feed(connection, "GET /b HTTP/1.1\r\n\r\nGET /a HTTP/1.1\r\n\r\n", *router);
+        REQUIRE(*output);
+        REQUIRE(**output);
+
+        const auto data = written(**output);
+        REQUIRE(data.find("second") < data.find("HTTP/1.1 200 OK", 1));
+        REQUIRE(data.ends_with("first"));
+        REQUIRE_FALSE((**output)->close_after);
+        REQUIRE((**output)->awaiting == TcpInputState::idle);
+    }
+
+    SECTION("A request split across reads is answered once it is complete")
+    {
+        auto head = feed(connection, "GET /a HTTP/1.1\r\nHo", *router);
+        REQUIRE(*head);
+        REQUIRE_FALSE(**head);
+
+        auto rest = feed(connection, "st: example.com\r\n\r\nGET /b HTTP/1.1\r\n", *router);
+        REQUIRE(*rest);
+        REQUIRE(written(**rest).ends_with("first"));
+        REQUIRE((**rest)->awaiting == TcpInputState::header);
+
+        auto last = feed(connection, "\r\n", *router);
+        REQUIRE(written(**last).ends_with("second"));
+        REQUIRE((**last)->awaiting == TcpInputState::idle);
+    }
+
+    SECTION("Connection: close ends the connection after its response")
+    {
+        auto output = feed(connection, "GET /a HTTP/1.1\r\nConnection: close\r\n\r\nGET /b HTTP/1.1\r\n\r\n", *router);
+        REQUIRE(*output);
+
+        const auto data = written(**output);
+        REQUIRE(data.find("Connection: close\r\n") != std::string::npos);
+        REQUIRE(data.ends_with("first"));
+        REQUIRE((**output)->close_after);
+    }
+
+    SECTION("HTTP/1.0 keeps the connection open only when asked to")
+    {
+        auto output = feed(connection, "GET /a HTTP/1.0\r\n\r\n", *router);
+        REQUIRE((**output)->close_after);
+
+        HttpConnection kept{*router};
+        auto kept_output = feed(kept, "GET /a HTTP/1.0\r\nConnection: keep-alive\r\n\r\n", *router);
+        REQUIRE(written(**kept_output).find("Connection: keep-alive\r\n") != std::string::npos);
+        REQUIRE_FALSE((**kept_output)->close_after);
+    }
+}
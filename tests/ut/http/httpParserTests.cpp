@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/httpParser.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::http;
+
+constexpr std::string_view REQUEST = "POST /users/42?verbose=1 HTTP/1.1\r\n"
+                                     "Host: localhost\r\n"
+                                     "Content-Type:  application/json \r\n"
+                                     "Content-Length: 13\r\n"
+                                     "\r\n"
+                                     "{\"name\":\"zx\"}";
+}
+
+TEST_CASE("HttpParser - complete request", "[http][parser]")
+{
+    HttpParser parser;
+
+    REQUIRE(parser.feed(REQUEST) == HttpParseStatus::complete);
+
+    const auto& request = parser.request();
+    REQUIRE(request.method == "POST");
+    REQUIRE(request.path == "/users/42?verbose=1");
+    REQUIRE(request.version == "HTTP/1.1");
+    REQUIRE(request.headers().size() == 3);
+    REQUIRE(request.header("host") == "localhost");
+    REQUIRE(request.header("CONTENT-TYPE") == "application/json");
+    REQUIRE_FALSE(request.header("Accept").has_value());
+    REQUIRE(request.body == "{\"name\":\"zx\"}");
+    REQUIRE(parser.consumed() == REQUEST.size());
+
+    SECTION("Views point into the caller's buffer")
+    {
+        REQUIRE(request.method.data() == REQUEST.data());
+        REQUIRE(request.body.data() == REQUEST.data() + REQUEST.size() - request.body.size());
+    }
+}
+
+TEST_CASE("HttpParser - incremental feeding", "[http][parser]")
+{
+    SECTION("One byte at a time into a growing buffer")
+    {
+        HttpParser parser;
+        std::string buffer;
+
+        for (std::size_t i = 0; i + 1 < REQUEST.size(); ++i) {
+            buffer += REQUEST[i];
+            REQUIRE(parser.feed(buffer) == HttpParseStatus::incomplete);
+        }
+
+        buffer += REQUEST.back();
+        REQUIRE(parser.feed(buffer) == HttpParseStatus::complete);
+        REQUIRE(parser.request().path == "/users/42?verbose=1");
+        REQUIRE(parser.request().header("Host") == "localhost");
+        REQUIRE(parser.request().body == "{\"name\":\"zx\"}");
+    }
+
+    SECTION("Bytes after the request are left for the next one")
+    {
+        HttpParser parser;
+        std::string buffer{"GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.1\r\n\r\n"};
+
+        REQUIRE(parser.feed(buffer) == HttpParseStatus::complete);
+        REQUIRE(parser.request().path == "/a");
+
+        buffer.erase(0, parser.consumed());
+        parser.reset();
+
+        REQUIRE(parser.feed(buffer) == HttpParseStatus::complete);
+        REQUIRE(parser.request().path == "/b");
+        REQUIRE(parser.consumed() == buffer.size());
+    }
+}
+
+TEST_CASE("HttpParser - chunked bodies", "[http][parser]")
+{
+    constexpr std::string_view chunked = "POST /upload HTTP/1.1\r\n"
+                                         "Transfer-Encoding: chunked\r\n"
+                                         "\r\n"
+                                         "5;name=value\r\nhello\r\n"
+                                         "7\r\n, world\r\n"
+                                         "0\r\n"
+                                         "X-Checksum: 1\r\n"
+                                         "\r\n"
+                                         "GET /next HTTP/1.1\r\n\r\n";
+    const auto message_size = chunked.find("GET /next");
+
+    SECTION("Chunks are joined and trailers dropped")
+    {
+        HttpParser parser;
+
+        REQUIRE(parser.feed(chunked) == HttpParseStatus::complete);
+        REQUIRE(parser.request().body == "hello, world");
+        REQUIRE(parser.consumed() == message_size);
+    }
+
+    SECTION("One byte at a time into a growing buffer")
+    {
+        HttpParser parser;
+        std::string buffer;
+
+        for (std::size_t i = 0; i + 1 < message_size; ++i) {
+            buffer += chunked[i];
+            REQUIRE(parser.feed(buffer) == HttpParseStatus::incomplete);
+        }
+
+        buffer += chunked[message_size - 1];
+        REQUIRE(parser.feed(buffer) == HttpParseStatus::complete);
+        REQUIRE(parser.request().body == "hello, world");
+        REQUIRE(parser.consumed() == message_size);
+    }
+
+    SECTION("The decoded body counts against the body limit")
+    {
+        HttpParser parser{{.max_body_bytes = 8}};
+        REQUIRE(parser.feed(chunked) == HttpParseStatus::error);
+    }
+}
+
+TEST_CASE("HttpParser - head only", "[http][parser]")
+{
+    constexpr std::string_view raw = "POST /upload HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello";
+    const auto head_size = raw.find("hello");
+
+    HttpParser parser{{.max_body_bytes = 4}};
+
+    SECTION("The request is published without its body")
+    {
+        REQUIRE(parser.feed_head(raw.substr(0, head_size - 1)) == HttpParseStatus::incomplete);
+        REQUIRE(parser.feed_head(raw.substr(0, head_size)) == HttpParseStatus::complete);
+        REQUIRE(parser.request().path == "/upload");
+        REQUIRE(parser.request().body.empty());
+        REQUIRE(parser.body_offset() == head_size);
+        REQUIRE(parser.content_length() == 5);
+        REQUIRE_FALSE(parser.is_chunked());
+    }
+
+    SECTION("feed() continues with the body and applies the limit")
+    {
+        REQUIRE(parser.feed_head(raw) == HttpParseStatus::complete);
+        REQUIRE(parser.feed(raw) == HttpParseStatus::error);
+    }
+}
+
+TEST_CASE("HttpParser - malformed input", "[http][parser]")
+{
+    auto status = [](std::string_view t_raw, HttpParserLimits t_limits = {}) {
+        HttpParser parser{t_limits};
+        return parser.feed(t_raw);
+    };
+
+    REQUIRE(status("GET\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / FTP/1.0\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / HTTP/1.1\r\nNoColon\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / HTTP/1.1\r\nBad Name: x\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 2\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n") == HttpParseStatus::error);
+    REQUIRE(status("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nContent-Length: 3\r\n\r\n")
+            == HttpParseStatus::error);
+    REQUIRE(status("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n") == HttpParseStatus::error);
+    REQUIRE(status("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabcX\r\n") == HttpParseStatus::error);
+    REQUIRE(status("GET / HTTP/1.1\r\nHost: a\r\n", {.max_header_bytes = 8}) == HttpParseStatus::error);
+
+    std::string many{"GET / HTTP/1.1\r\n"};
+    for (std::size_t i = 0; i <= HttpRequestView::max_headers; ++i) {
+        many += "X-H: v\r\n";
+    }
+    many += "\r\n";
+    REQUIRE(status(many) == HttpParseStatus::error);
+}
+
+TEST_CASE("HttpParser - one-shot parse", "[http][parser]")
+{
+    auto request = HttpParser::parse(REQUEST);
+
+    REQUIRE(request.has_value());
+    REQUIRE(request->method == "POST");
+    REQUIRE(request->headers.at("Content-Type") == "application/json");
+    REQUIRE(request->body == "{\"name\":\"zx\"}");
+
+    REQUIRE_FALSE(HttpParser::parse("GET / HTTP/1.1\r\nHost: a\r\n").has_value());
+}
@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/httpRequestStream.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace
+{
+using namespace zephyr::http;
+
+auto request_at(const std::vector<HttpStreamItem>& t_items, std::size_t t_index) -> const FramedRequest&
+{
+    return std::get<FramedRequest>(t_items[t_index]);
+}
+
+auto piece_at(const std::vector<HttpStreamItem>& t_items, std::size_t t_index) -> const BodyPiece&
+{
+    return std::get<BodyPiece>(t_items[t_index]);
+}
+
+// Streams the body of every POST to /upload
+auto streams_uploads(const HttpRequestView& t_request) -> bool
+{
+    return t_request.method == "POST" && t_request.path == "/upload";
+}
+}
+
+TEST_CASE("HttpRequestStream - framing", "[http][stream]")
+{
+    HttpRequestStream stream;
+    std::vector<HttpStreamItem> items;
+
+    SECTION("Pipelined requests in one read come out in order")
+    {
+        REQUIRE(stream.feed("GET /a HTTP/1.1\r\n\r\n"
+                            "POST /b HTTP/1.1\r\nContent-Length: 3\r\n\r\nxyz"
+                            "GET /c HTTP/1.1\r\n\r\n",
+                            items)
+                == HttpStreamStatus::open);
+
+        REQUIRE(items.size() == 3);
+        REQUIRE(request_at(items, 0).request.path == "/a");
+        REQUIRE(request_at(items, 1).request.body == "xyz");
+        REQUIRE(request_at(items, 2).request.path == "/c");
+        REQUIRE(stream.buffered() == 0);
+    }
+
+    SECTION("A body split across reads is completed by the next one")
+    {
+        REQUIRE(stream.feed("GET /a HTTP/1.1\r\n\r\nPOST /b HTTP/1.1\r\nContent-Length: 10\r\n\r\n01234", items)
+                == HttpStreamStatus::open);
+        REQUIRE(items.size() == 1);
+        REQUIRE(stream.buffered() > 0);
+
+        REQUIRE(stream.feed("56789GET /c HT", items) == HttpStreamStatus::open);
+        REQUIRE(items.size() == 2);
+        REQUIRE(request_at(items, 1).request.body == "0123456789");
+
+        REQUIRE(stream.feed("TP/1.1\r\n\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(items.size() == 3);
+        REQUIRE(request_at(items, 2).request.path == "/c");
+        REQUIRE(stream.buffered() == 0);
+    }
+
+    SECTION("Chunked bodies are framed")
+    {
+        REQUIRE(stream.feed("POST /up HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabc\r\n", items)
+                == HttpStreamStatus::open);
+        REQUIRE(items.empty());
+
+        REQUIRE(stream.feed("0\r\n\r\nGET /next HTTP/1.1\r\n\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(items.size() == 2);
+        REQUIRE(request_at(items, 0).request.body == "abc");
+        REQUIRE(request_at(items, 1).request.path == "/next");
+    }
+
+    SECTION("Connection: close ends the stream after that request")
+    {
+        REQUIRE(stream.feed("GET /a HTTP/1.1\r\nConnection: close\r\n\r\nGET /b HTTP/1.1\r\n\r\n", items)
+                == HttpStreamStatus::closing);
+        REQUIRE(items.size() == 1);
+        REQUIRE_FALSE(request_at(items, 0).keep_alive);
+
+        REQUIRE(stream.feed("GET /c HTTP/1.1\r\n\r\n", items) == HttpStreamStatus::closing);
+        REQUIRE(items.size() == 1);
+    }
+
+    SECTION("HTTP/1.0 closes unless asked to keep the connection")
+    {
+        REQUIRE(stream.feed("GET /a HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(request_at(items, items.size() - 1).keep_alive);
+
+        REQUIRE(stream.feed("GET /b HTTP/1.0\r\n\r\n", items) == HttpStreamStatus::closing);
+        REQUIRE_FALSE(request_at(items, items.size() - 1).keep_alive);
+    }
+
+    SECTION("Requests before a malformed one are still delivered")
+    {
+        REQUIRE(stream.feed("GET /a HTTP/1.1\r\n\r\nnonsense\r\n\r\n", items) == HttpStreamStatus::error);
+        REQUIRE(items.size() == 1);
+    }
+}
+
+TEST_CASE("HttpRequestStream - streamed bodies", "[http][stream]")
+{
+    HttpRequestStream stream{{.max_body_bytes = 4}, streams_uploads};
+    std::vector<HttpStreamItem> items;
+
+    SECTION("The request comes out with its headers and the body follows read by read")
+    {
+        REQUIRE(stream.feed("POST /upload HTTP/1.1\r\nContent-Length: 10\r\n\r\n012", items)
+                == HttpStreamStatus::open);
+        REQUIRE(items.size() == 2);
+        REQUIRE(request_at(items, 0).streams_body);
+        REQUIRE(request_at(items, 0).request.body.empty());
+        REQUIRE(piece_at(items, 1).data == "012");
+        REQUIRE_FALSE(piece_at(items, 1).last);
+        REQUIRE(stream.buffered() == 0);
+
+        REQUIRE(stream.feed("3456", items) == HttpStreamStatus::open);
+        REQUIRE(piece_at(items, 2).data == "3456");
+        REQUIRE(stream.buffered() == 0);
+
+        REQUIRE(stream.feed("789GET /next HTTP/1.1\r\n\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(items.size() == 5);
+        REQUIRE(piece_at(items, 3).data == "789");
+        REQUIRE(piece_at(items, 3).last);
+        REQUIRE(request_at(items, 4).request.path == "/next");
+        REQUIRE_FALSE(request_at(items, 4).streams_body);
+    }
+
+    SECTION("Chunked bodies are decoded as they arrive")
+    {
+        REQUIRE(stream.feed("POST /upload HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhel", items)
+                == HttpStreamStatus::open);
+        REQUIRE(items.size() == 2);
+        REQUIRE(piece_at(items, 1).data == "hel");
+
+        REQUIRE(stream.feed("lo\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(stream.feed("0\r", items) == HttpStreamStatus::open);
+        REQUIRE(stream.feed("\n\r\n", items) == HttpStreamStatus::open);
+
+        REQUIRE(items.size() == 4);
+        REQUIRE(piece_at(items, 2).data == "lo");
+        REQUIRE(piece_at(items, 3).data.empty());
+        REQUIRE(piece_at(items, 3).last);
+    }
+
+    SECTION("An empty body still ends")
+    {
+        REQUIRE(stream.feed("POST /upload HTTP/1.1\r\nContent-Length: 0\r\n\r\n", items) == HttpStreamStatus::open);
+        REQUIRE(items.size() == 2);
+        REQUIRE(piece_at(items, 1).last);
+    }
+
+    SECTION("Other requests are still buffered and keep the body limit")
+    {
+        REQUIRE(stream.feed("POST /small HTTP/1.1\r\nContent-Length: 3\r\n\r\nab", items) == HttpStreamStatus::open);
+        REQUIRE(items.empty());
+        REQUIRE(stream.feed("c", items) == HttpStreamStatus::open);
+        REQUIRE(request_at(items, 0).request.body == "abc");
+
+        REQUIRE(stream.feed("POST /small HTTP/1.1\r\nContent-Length: 5\r\n\r\n", items) == HttpStreamStatus::error);
+    }
+
+    SECTION("Connection: close takes effect once the streamed body ends")
+    {
+        REQUIRE(stream.feed("POST /upload HTTP/1.1\r\nConnection: close\r\nContent-Length: 2\r\n\r\na", items)
+                == HttpStreamStatus::open);
+        REQUIRE(stream.feed("bGET / HTTP/1.1\r\n\r\n", items) == HttpStreamStatus::closing);
+        REQUIRE(items.size() == 3);
+        REQUIRE(piece_at(items, 2).last);
+    }
+}
@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/details/httpDate.hpp>
+#include <zephyr/http/httpHeaders.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpSerializer.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::http;
+}
+
+TEST_CASE("HttpSerializer - flat output", "[http][serializer]")
+{
+    auto response = HttpResponse::ok("hello");
+    response.headers["X-Trace"] = "1";
+    response.headers["Accept-Ranges"] = "bytes";
+    response.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+
+    REQUIRE(HttpSerializer::serialize(response)
+            == "HTTP/1.1 200 OK\r\n"
+               "Accept-Ranges: bytes\r\n"
+               "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+               "X-Trace: 1\r\n"
+               "Content-Length: 5\r\n"
+               "\r\n"
+               "hello");
+
+    SECTION("Responses without a body still state their length, unless they cannot have one")
+    {
+        response.body.clear();
+        REQUIRE(HttpSerializer::serialize(response).find("Content-Length: 0\r\n") != std::string::npos);
+
+        response.status_code = 204;
+        response.status_text = "No Content";
+        REQUIRE(HttpSerializer::serialize(response).find("Content-Length") == std::string::npos);
+    }
+
+    SECTION("An explicit Content-Length is kept")
+    {
+        response.headers["Content-Length"] = "5";
+        REQUIRE(HttpSerializer::serialize(response).find("Content-Length: 5\r\n") != std::string::npos);
+    }
+}
+
+TEST_CASE("HttpSerializer - vectored output", "[http][serializer]")
+{
+    SECTION("Matches the flat output byte for byte")
+    {
+        auto response = HttpResponse::json(R"({"id":42})");
+        response.headers["Server"] = "zephyr";
+        response.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+
+        const auto expected = HttpSerializer::serialize(response);
+        REQUIRE(HttpSerializer::serialize_vectored(response).flatten() == expected);
+    }
+
+    SECTION("Standard status lines are static and the body is its own segment")
+    {
+        const std::string body(64 * 1024, 'x');
+        auto output = HttpSerializer::serialize_vectored(HttpResponse::ok(body));
+
+        REQUIRE(output.segment_count() == 3);
+        REQUIRE(output.segment(0).data() == HttpSerializer::status_line(200, "OK").data());
+        REQUIRE(output.segment(2) == body);
+
+        std::size_t total = 0;
+        for (const auto& vector : output.vectors()) {
+            total += vector.iov_len;
+        }
+        REQUIRE(total == output.size());
+    }
+
+    SECTION("Custom reasons are rendered")
+    {
+        HttpResponse response;
+        response.status_code = 200;
+        response.status_text = "Fine";
+        response.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+
+        auto output = HttpSerializer::serialize_vectored(response);
+        REQUIRE(output.segment_count() == 1);
+        REQUIRE(output.flatten() == "HTTP/1.1 200 Fine\r\nDate: Sun, 06 Nov 1994 08:49:37 GMT\r\nContent-Length: 0\r\n\r\n");
+    }
+}
+
+TEST_CASE("HttpSerializer - status lines and Date", "[http][serializer]")
+{
+    SECTION("Registered codes have pre-rendered lines")
+    {
+        REQUIRE(HttpSerializer::status_line(100, "Continue") == "HTTP/1.1 100 Continue\r\n");
+        REQUIRE(HttpSerializer::status_line(404, "Not Found") == "HTTP/1.1 404 Not Found\r\n");
+        REQUIRE(HttpSerializer::status_line(511, "Network Authentication Required")
+                == "HTTP/1.1 511 Network Authentication Required\r\n");
+
+        REQUIRE(HttpSerializer::status_line(404, "Gone Fishing").empty());
+        REQUIRE(HttpSerializer::status_line(299, "OK").empty());
+        REQUIRE(HttpSerializer::status_line(42, "OK").empty());
+    }
+
+    SECTION("Dates are IMF-fixdate")
+    {
+        char out[details::http_date_size];
+        details::format_http_date(784111777, out);
+        REQUIRE(std::string_view{out, sizeof(out)} == "Sun, 06 Nov 1994 08:49:37 GMT");
+
+        const auto now = details::cached_http_date();
+        REQUIRE(now.size() == details::http_date_size);
+        REQUIRE(now.ends_with(" GMT"));
+    }
+
+    SECTION("A Date header is added unless the handler set one")
+    {
+        const auto output = HttpSerializer::serialize(HttpResponse::ok("x"));
+        REQUIRE(output.find("\r\nDate: ") != std::string::npos);
+    }
+}
+
+TEST_CASE("HttpSerializer - streamed bodies", "[http][serializer]")
+{
+    HttpResponse response;
+    response.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+
+    SECTION("A chunked head announces the framing and states no length")
+    {
+        REQUIRE(HttpSerializer::serialize_head(response, true).flatten()
+                == "HTTP/1.1 200 OK\r\n"
+                   "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+                   "Transfer-Encoding: chunked\r\n"
+                   "\r\n");
+    }
+
+    SECTION("Chunks carry their size in hex")
+    {
+        REQUIRE(HttpSerializer::chunk(std::string(26, 'x')).flatten() == "1a\r\n" + std::string(26, 'x') + "\r\n");
+        REQUIRE(HttpSerializer::chunk("").empty());
+        REQUIRE(HttpSerializer::last_chunk == "0\r\n\r\n");
+    }
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/details/radixTree.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+using namespace zephyr::http::details;
+}
+
+TEST_CASE("RadixTree - static routes", "[http][router]")
+{
+    RadixTree tree;
+    tree.insert("GET", "/", 0);
+    tree.insert("GET", "/users", 1);
+    tree.insert("GET", "/users/me", 2);
+    tree.insert("GET", "/uploads", 3);
+    tree.insert("POST", "/users", 4);
+
+    RouteMatch match;
+
+    REQUIRE(tree.find("GET", "/", match));
+    REQUIRE(match.route == 0);
+    REQUIRE(tree.find("GET", "/users", match));
+    REQUIRE(match.route == 1);
+    REQUIRE(tree.find("GET", "/users/me", match));
+    REQUIRE(match.route == 2);
+    REQUIRE(tree.find("GET", "/uploads", match));
+    REQUIRE(match.route == 3);
+    REQUIRE(tree.find("POST", "/users", match));
+    REQUIRE(match.route == 4);
+
+    REQUIRE_FALSE(tree.find("GET", "/user", match));
+    REQUIRE_FALSE(tree.find("GET", "/users/", match));
+    REQUIRE_FALSE(tree.find("DELETE", "/users", match));
+}
+
+TEST_CASE("RadixTree - parameters and wildcards", "[http][router]")
+{
+    RadixTree tree;
+    tree.insert("GET", "/users/:id", 0);
+    tree.insert("GET", "/users/:id/orders/:order", 1);
+    tree.insert("GET", "/users/me", 2);
+    tree.insert("*", "/static/*", 3);
+    tree.insert("POST", "/users/me/avatar", 4);
+    tree.insert("GET", "/users/:id/avatar", 5);
+
+    RouteMatch match;
+
+    SECTION("Parameters capture one segment each")
+    {
+        REQUIRE(tree.find("GET", "/users/42", match));
+        REQUIRE(match.route == 0);
+        REQUIRE(match.params().size() == 1);
+        REQUIRE(match.params()[0] == "42");
+
+        REQUIRE(tree.find("GET", "/users/42/orders/7", match));
+        REQUIRE(match.route == 1);
+        REQUIRE(match.params().size() == 2);
+        REQUIRE(match.params()[0] == "42");
+        REQUIRE(match.params()[1] == "7");
+
+        REQUIRE_FALSE(tree.find("GET", "/users//orders/7", match));
+    }
+
+    SECTION("Static text wins over parameters")
+    {
+        REQUIRE(tree.find("GET", "/users/me", match));
+        REQUIRE(match.route == 2);
+        REQUIRE(match.params().empty());
+    }
+
+    SECTION("Lookup backtracks when the static branch has no route for the method")
+    {
+        REQUIRE(tree.find("GET", "/users/me/avatar", match));
+        REQUIRE(match.route == 5);
+        REQUIRE(match.params()[0] == "me");
+
+        REQUIRE(tree.find("POST", "/users/me/avatar", match));
+        REQUIRE(match.route == 4);
+        REQUIRE(match.params().empty());
+    }
+
+    SECTION("A trailing wildcard takes the rest of the path for any method")
+    {
+        REQUIRE(tree.find("GET", "/static/css/site.css", match));
+        REQUIRE(match.route == 3);
+        REQUIRE(tree.find("PUT", "/static/", match));
+        REQUIRE(match.route == 3);
+        REQUIRE_FALSE(tree.find("GET", "/static", match));
+    }
+}
+
+TEST_CASE("RadixTree - registration rules", "[http][router]")
+{
+    RadixTree tree;
+    RouteMatch match;
+
+    tree.insert("GET", "/a", 0);
+    tree.insert("GET", "/a", 1);
+    REQUIRE(tree.find("GET", "/a", match));
+    REQUIRE(match.route == 0);
+
+    REQUIRE_THROWS_AS(tree.insert("GET", "/files/*/raw", 2), std::invalid_argument);
+
+    std::string pattern;
+    for (std::size_t i = 0; i <= RouteMatch::max_params; ++i) {
+        pattern += "/:p" + std::to_string(i);
+    }
+    REQUIRE_THROWS_AS(tree.insert("GET", pattern, 3), std::invalid_argument);
+}
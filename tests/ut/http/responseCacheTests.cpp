@@ -0,0 +1,223 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/httpSerializer.hpp>
+#include <zephyr/http/responseCache.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace zephyr::http;
+
+auto get(std::string t_path) -> HttpRequest
+{
+    HttpRequest request;
+    request.method = "GET";
+    request.path = std::move(t_path);
+    request.version = "HTTP/1.1";
+    return request;
+}
+
+auto response(std::string t_body) -> HttpResponse
+{
+    auto result = HttpResponse::ok(std::move(t_body));
+    result.headers["Date"] = "Sun, 06 Nov 1994 08:49:37 GMT";
+    return result;
+}
+
+// Runs a miss to completion, as the request that missed does
+auto fill(ResponseCache& t_cache, const std::string& t_key, HttpResponse t_response) -> HttpResponse
+{
+    HttpResponse hit;
+    REQUIRE(t_cache.lookup(t_key, hit, nullptr) == CacheLookup::miss);
+    return t_cache.complete(t_key, std::move(t_response));
+}
+
+auto ignore(std::optional<HttpResponse>) -> void {}
+}
+
+TEST_CASE("ResponseCache - keys", "[http][response_cache]")
+{
+    ResponseCache cache{{.key_headers = {"Accept-Encoding"}}};
+
+    SECTION("Method, path with query and the selected headers make the key")
+    {
+        auto plain = get("/items?page=2");
+        auto gzip = get("/items?page=2");
+        gzip.headers["accept-encoding"] = "gzip";
+
+        REQUIRE_FALSE(cache.key(plain).empty());
+        REQUIRE(cache.key(plain) != cache.key(get("/items?page=3")));
+        REQUIRE(cache.key(plain) != cache.key(gzip));
+
+        plain.headers["User-Agent"] = "curl";
+        REQUIRE(cache.key(plain) == cache.key(get("/items?page=2")));
+    }
+
+    SECTION("Requests that may not be answered from the cache have no key")
+    {
+        auto post = get("/items");
+        post.method = "POST";
+        REQUIRE(cache.key(post).empty());
+
+        auto no_cache = get("/items");
+        no_cache.headers["Cache-Control"] = "max-age=0, no-cache";
+        REQUIRE(cache.key(no_cache).empty());
+
+        auto authorized = get("/items");
+        authorized.headers["Authorization"] = "Bearer secret";
+        REQUIRE(cache.key(authorized).empty());
+
+        ResponseCache per_user{{.key_headers = {"Authorization"}}};
+        REQUIRE_FALSE(per_user.key(authorized).empty());
+    }
+}
+
+TEST_CASE("ResponseCache - hits, expiry and eviction", "[http][response_cache]")
+{
+    SECTION("A stored response is served prerendered, with its age")
+    {
+        ResponseCache cache;
+        const auto key = cache.key(get("/items"));
+
+        auto first = fill(cache, key, response("[1,2,3]"));
+        REQUIRE(first.prerendered);
+        REQUIRE(first.headers.empty());
+
+        HttpResponse hit;
+        REQUIRE(cache.lookup(key, hit, nullptr) == CacheLookup::hit);
+        REQUIRE(hit.prerendered == first.prerendered);
+        REQUIRE(hit.status_code == 200);
+        REQUIRE(hit.headers.at("Age") == "0");
+
+        hit.headers["Connection"] = "close";
+        REQUIRE(HttpSerializer::serialize(hit)
+                == "HTTP/1.1 200 OK\r\n"
+                   "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+                   "Content-Length: 7\r\n"
+                   "Age: 0\r\n"
+                   "Connection: close\r\n"
+                   "\r\n"
+                   "[1,2,3]");
+        REQUIRE(HttpSerializer::serialize_vectored(hit).flatten() == HttpSerializer::serialize(hit));
+    }
+
+    SECTION("Entries expire after the TTL")
+    {
+        ResponseCache cache{{.ttl = std::chrono::milliseconds{20}}};
+        const auto key = cache.key(get("/items"));
+        fill(cache, key, response("old"));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{30});
+
+        HttpResponse hit;
+        REQUIRE(cache.lookup(key, hit, nullptr) == CacheLookup::miss);
+        REQUIRE(cache.size() == 0);
+    }
+
+    SECTION("The byte budget evicts the least recently used entries")
+    {
+        ResponseCache cache{{.shards = 1, .max_bytes = 600}};
+        const std::string body(100, 'x');
+
+        fill(cache, "a", response(body));
+        fill(cache, "b", response(body));
+        fill(cache, "c", response(body));
+
+        HttpResponse hit;
+        REQUIRE(cache.lookup("a", hit, nullptr) == CacheLookup::hit);
+        fill(cache, "d", response(body));
+
+        REQUIRE(cache.bytes() <= 600);
+        REQUIRE(cache.lookup("a", hit, nullptr) == CacheLookup::hit);
+        REQUIRE(cache.lookup("d", hit, nullptr) == CacheLookup::hit);
+        REQUIRE(cache.lookup("b", hit, nullptr) == CacheLookup::miss);
+    }
+
+    SECTION("Responses over the entry limit are sent but not stored")
+    {
+        ResponseCache cache{{.max_entry_bytes = 64}};
+
+        auto sent = fill(cache, "big", response(std::string(100, 'x')));
+        REQUIRE(sent.prerendered);
+        REQUIRE(cache.size() == 0);
+    }
+}
+
+TEST_CASE("ResponseCache - cacheable responses", "[http][response_cache]")
+{
+    REQUIRE(ResponseCache::cacheable(response("ok")));
+    REQUIRE(ResponseCache::cacheable(HttpResponse::not_found()));
+
+    auto created = response("ok");
+    created.status_code = 201;
+    REQUIRE_FALSE(ResponseCache::cacheable(created));
+
+    auto cookie = response("ok");
+    cookie.headers["Set-Cookie"] = "id=1";
+    REQUIRE_FALSE(ResponseCache::cacheable(cookie));
+
+    auto personal = response("ok");
+    personal.headers["Cache-Control"] = "Private, max-age=10";
+    REQUIRE_FALSE(ResponseCache::cacheable(personal));
+
+    auto file = response("ok");
+    file.file_body = zephyr::io::FileRegion{};
+    REQUIRE_FALSE(ResponseCache::cacheable(file));
+
+    SECTION("An uncacheable response is sent as it is and not stored")
+    {
+        ResponseCache cache;
+        auto sent = fill(cache, "k", cookie);
+        REQUIRE_FALSE(sent.prerendered);
+        REQUIRE(sent.headers.at("Set-Cookie") == "id=1");
+        REQUIRE(cache.size() == 0);
+    }
+}
+
+TEST_CASE("ResponseCache - collapsed misses", "[http][response_cache]")
+{
+    ResponseCache cache;
+    const std::string key = "GET /slow";
+
+    HttpResponse hit;
+    REQUIRE(cache.lookup(key, hit, nullptr) == CacheLookup::miss);
+
+    std::vector<std::optional<HttpResponse>> received;
+    auto waiter = [&received](std::optional<HttpResponse> t_response) {
+        received.push_back(std::move(t_response));
+    };
+
+    REQUIRE(cache.lookup(key, hit, waiter) == CacheLookup::joined);
+    REQUIRE(cache.lookup(key, hit, waiter) == CacheLookup::joined);
+    REQUIRE(received.empty());
+
+    SECTION("The joined requests get the response of the one that missed")
+    {
+        auto sent = cache.complete(key, response("done"));
+
+        REQUIRE(received.size() == 2);
+        for (const auto& joined : received) {
+            REQUIRE(joined);
+            REQUIRE(joined->prerendered == sent.prerendered);
+        }
+        REQUIRE(cache.lookup(key, hit, ignore) == CacheLookup::hit);
+    }
+
+    SECTION("When there is nothing to share, they are told to run the handler")
+    {
+        cache.abandon(key);
+
+        REQUIRE(received.size() == 2);
+        REQUIRE_FALSE(received[0]);
+        REQUIRE_FALSE(received[1]);
+
+        // The next request misses again instead of waiting forever
+        REQUIRE(cache.lookup(key, hit, ignore) == CacheLookup::miss);
+    }
+}
@@ -0,0 +1,270 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/details/openFileCache.hpp>
+#include <zephyr/http/httpHeaders.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/staticFiles.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <unistd.h>
+
+namespace
+{
+using namespace zephyr::http;
+using zephyr::context::Context;
+namespace fs = std::filesystem;
+
+// A directory of files removed again at the end of the test
+class TempDir
+{
+public:
+    TempDir()
+    {
+        std::string pattern = (fs::temp_directory_path() / "zephyr-static-XXXXXX").string();
+        m_path = ::mkdtemp(pattern.data());
+    }
+
+    ~TempDir()
+    {
+        std::error_code ignored;
+        fs::remove_all(m_path, ignored);
+    }
+
+    auto write(const std::string& t_name, std::string_view t_content) const -> void
+    {
+        fs::create_directories((m_path / t_name).parent_path());
+        std::ofstream{m_path / t_name, std::ios::binary | std::ios::trunc} << t_content;
+    }
+
+    auto path() const -> std::string { return m_path.string(); }
+
+private:
+    fs::path m_path;
+};
+
+auto request(std::string t_method, std::string t_path) -> HttpRequest
+{
+    HttpRequest request;
+    request.method = std::move(t_method);
+    request.path = std::move(t_path);
+    request.version = "HTTP/1.1";
+    return request;
+}
+
+// What a GET response would put on the wire as its body
+auto body_of(const HttpResponse& t_response) -> std::string
+{
+    REQUIRE(t_response.file_body);
+    const auto& region = *t_response.file_body;
+
+    std::string out(region.length, '\0');
+    REQUIRE(::pread(region.fd, out.data(), out.size(), static_cast<off_t>(region.offset))
+            == static_cast<ssize_t>(out.size()));
+    return out;
+}
+}
+
+TEST_CASE("StaticFiles - serving files", "[http][static_files]")
+{
+    TempDir root;
+    root.write("hello.txt", "hello, world");
+    root.write("index.html", "<h1>home</h1>");
+    root.write("docs/index.html", "<h1>docs</h1>");
+    root.write("docs/app.JS", "run()");
+
+    const StaticFiles files{"/static", root.path()};
+    const Context context;
+
+    SECTION("A file is sent as a region of its descriptor, with its validators")
+    {
+        auto response = files(request("GET", "/static/hello.txt"), context);
+
+        REQUIRE(response.status_code == 200);
+        REQUIRE(response.body.empty());
+        REQUIRE(body_of(response) == "hello, world");
+        REQUIRE(response.headers.at("Content-Type") == "text/plain; charset=utf-8");
+        REQUIRE(response.headers.at("Accept-Ranges") == "bytes");
+        REQUIRE(response.headers.at("ETag").starts_with("\""));
+        REQUIRE(response.headers.at("Last-Modified").ends_with(" GMT"));
+    }
+
+    SECTION("The query string, repeated slashes and escapes do not change the file")
+    {
+        REQUIRE(body_of(files(request("GET", "/static/hello.txt?v=2"), context)) == "hello, world");
+        REQUIRE(body_of(files(request("GET", "/static//./hello%2Etxt"), context)) == "hello, world");
+    }
+
+    SECTION("Directories are served through their index file")
+    {
+        REQUIRE(body_of(files(request("GET", "/static/"), context)) == "<h1>home</h1>");
+        REQUIRE(body_of(files(request("GET", "/static/docs/"), context)) == "<h1>docs</h1>");
+        REQUIRE(files(request("GET", "/static/docs"), context).status_code == 404);
+    }
+
+    SECTION("Content types follow the extension, whatever its case")
+    {
+        REQUIRE(files(request("GET", "/static/docs/app.JS"), context).headers.at("Content-Type")
+                == "text/javascript; charset=utf-8");
+        REQUIRE(StaticFiles::content_type("archive.tar.zst") == "application/octet-stream");
+        REQUIRE(StaticFiles::content_type("Makefile") == "application/octet-stream");
+    }
+
+    SECTION("Paths leaving the root or that do not exist are not found")
+    {
+        root.write("../outside.txt", "secret");
+
+        REQUIRE(files(request("GET", "/static/../outside.txt"), context).status_code == 404);
+        REQUIRE(files(request("GET", "/static/%2e%2e/outside.txt"), context).status_code == 404);
+        REQUIRE(files(request("GET", "/static/hello.txt%00.png"), context).status_code == 404);
+        REQUIRE(files(request("GET", "/static/missing.txt"), context).status_code == 404);
+        REQUIRE(files(request("GET", "/other/hello.txt"), context).status_code == 404);
+
+        fs::remove(fs::path(root.path()).parent_path() / "outside.txt");
+    }
+
+    SECTION("HEAD states the length without a body")
+    {
+        auto response = files(request("HEAD", "/static/hello.txt"), context);
+
+        REQUIRE(response.status_code == 200);
+        REQUIRE_FALSE(response.file_body);
+        REQUIRE(response.headers.at("Content-Length") == "12");
+    }
+}
+
+TEST_CASE("StaticFiles - conditional requests", "[http][static_files]")
+{
+    TempDir root;
+    root.write("hello.txt", "hello, world");
+
+    const StaticFiles files{"/", root.path(), {.cache_control = "max-age=60"}};
+    const Context context;
+
+    const auto etag = files(request("GET", "/hello.txt"), context).headers.at("ETag");
+
+    SECTION("A matching If-None-Match gets 304 without a body")
+    {
+        for (const auto& condition : {etag, "\"other\", " + etag, "W/" + etag, std::string{"*"}}) {
+            auto conditional = request("GET", "/hello.txt");
+            conditional.headers["if-none-match"] = condition;
+
+            auto response = files(conditional, context);
+            REQUIRE(response.status_code == 304);
+            REQUIRE_FALSE(response.file_body);
+            REQUIRE(response.headers.at("ETag") == etag);
+            REQUIRE(response.headers.at("Cache-Control") == "max-age=60");
+        }
+    }
+
+    SECTION("Another ETag gets the file")
+    {
+        auto conditional = request("GET", "/hello.txt");
+        conditional.headers["If-None-Match"] = "\"other\"";
+
+        REQUIRE(files(conditional, context).status_code == 200);
+    }
+}
+
+TEST_CASE("StaticFiles - ranges", "[http][static_files]")
+{
+    TempDir root;
+    root.write("digits.txt", "0123456789");
+
+    const StaticFiles files{"/files", root.path()};
+    const Context context;
+
+    auto ranged = [&](std::string t_range) {
+        auto r = request("GET", "/files/digits.txt");
+        r.headers["Range"] = std::move(t_range);
+        return files(r, context);
+    };
+
+    SECTION("A single range gets 206 with that part of the file")
+    {
+        auto response = ranged("bytes=2-5");
+        REQUIRE(response.status_code == 206);
+        REQUIRE(response.headers.at("Content-Range") == "bytes 2-5/10");
+        REQUIRE(body_of(response) == "2345");
+
+        REQUIRE(body_of(ranged("bytes=7-")) == "789");
+        REQUIRE(body_of(ranged("bytes=-3")) == "789");
+        REQUIRE(body_of(ranged("bytes=-30")) == "0123456789");
+        REQUIRE(ranged("bytes=8-100").headers.at("Content-Range") == "bytes 8-9/10");
+    }
+
+    SECTION("A range past the end gets 416 with the file size")
+    {
+        for (const auto* range : {"bytes=10-", "bytes=12-20", "bytes=-0"}) {
+            auto response = ranged(range);
+            REQUIRE(response.status_code == 416);
+            REQUIRE(response.headers.at("Content-Range") == "bytes */10");
+            REQUIRE_FALSE(response.file_body);
+        }
+    }
+
+    SECTION("Several, malformed or foreign ranges get the whole file")
+    {
+        for (const auto* range : {"bytes=0-1,4-5", "bytes=5-2", "bytes=x-", "items=0-1"}) {
+            auto response = ranged(range);
+            REQUIRE(response.status_code == 200);
+            REQUIRE(body_of(response) == "0123456789");
+        }
+    }
+}
+
+TEST_CASE("OpenFileCache - descriptors and revalidation", "[http][static_files]")
+{
+    using zephyr::http::details::OpenFileCache;
+
+    TempDir root;
+    root.write("a.txt", "a");
+    root.write("b.txt", "b");
+    root.write("c.txt", "c");
+
+    SECTION("Hits share the open file and the least recently used one is evicted")
+    {
+        OpenFileCache cache{2, std::chrono::hours{1}};
+
+        auto a = cache.open(root.path() + "/a.txt");
+        REQUIRE(a);
+        REQUIRE(cache.open(root.path() + "/a.txt") == a);
+
+        cache.open(root.path() + "/b.txt");
+        cache.open(root.path() + "/a.txt");
+        cache.open(root.path() + "/c.txt");
+        REQUIRE(cache.size() == 2);
+
+        // b was evicted, a is still the same descriptor
+        REQUIRE(cache.open(root.path() + "/a.txt") == a);
+        REQUIRE(a->fd >= 0);
+    }
+
+    SECTION("Directories and missing files are not cached")
+    {
+        OpenFileCache cache{4, std::chrono::hours{1}};
+
+        REQUIRE_FALSE(cache.open(root.path()));
+        REQUIRE_FALSE(cache.open(root.path() + "/missing.txt"));
+        REQUIRE(cache.size() == 0);
+    }
+
+    SECTION("A changed file is reopened once its entry is due for a check")
+    {
+        OpenFileCache cache{4, std::chrono::nanoseconds{0}};
+
+        auto before = cache.open(root.path() + "/a.txt");
+        REQUIRE(cache.open(root.path() + "/a.txt") == before);
+
+        root.write("a.txt", "changed");
+        auto after = cache.open(root.path() + "/a.txt");
+        REQUIRE(after != before);
+        REQUIRE(after->size == 7);
+        REQUIRE(after->etag != before->etag);
+    }
+}
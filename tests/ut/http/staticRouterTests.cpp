@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/context/context.hpp>
+#include <zephyr/http/details/staticRouteTable.hpp>
+#include <zephyr/http/httpMessages.hpp>
+#include <zephyr/http/staticRouter.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace
+{
+using namespace zephyr::http;
+using zephyr::context::Context;
+
+auto request(std::string t_method, std::string t_path) -> HttpRequest
+{
+    HttpRequest request;
+    request.method = std::move(t_method);
+    request.path = std::move(t_path);
+    return request;
+}
+
+auto reply(std::string t_body)
+{
+    return [body = std::move(t_body)](const HttpRequest& /*unused*/, const Context& /*unused*/) {
+        return HttpResponse::ok(body);
+    };
+}
+
+constexpr auto capture(std::string_view t_pattern, std::string_view t_path) -> std::string_view
+{
+    std::array<std::string_view, 8> values{};
+    return details::match_pattern(t_pattern, t_path, values) ? values[0] : "<none>";
+}
+}
+
+TEST_CASE("StaticRouteTable - compile-time helpers", "[http][router][constexpr]")
+{
+    static_assert(details::is_static_pattern("/users/me"));
+    static_assert(!details::is_static_pattern("/users/:id"));
+    static_assert(!details::is_static_pattern("/files/*"));
+
+    static_assert(details::is_valid_pattern("/users/:id/orders/:order"));
+    static_assert(!details::is_valid_pattern("users"));
+    static_assert(!details::is_valid_pattern("/files/*/raw"));
+    static_assert(!details::is_valid_pattern("/users/:/x"));
+
+    static_assert(capture("/users/:id", "/users/42") == "42");
+    static_assert(capture("/users/:id", "/users/") == "<none>");
+    static_assert(capture("/users/:id", "/users/42/x") == "<none>");
+    static_assert(capture("/files/:dir/*", "/files/a/b/c.txt") == "a");
+
+    constexpr std::array<details::RouteKey, 4> keys{{
+        {"GET", "/"},
+        {"GET", "/users"},
+        {"POST", "/users"},
+        {"GET", "/users/:id"},
+    }};
+    constexpr auto table = details::build_perfect_hash(keys);
+
+    static_assert(table.find("GET", "/") == 0);
+    static_assert(table.find("GET", "/users") == 1);
+    static_assert(table.find("POST", "/users") == 2);
+    static_assert(!details::has_duplicate_routes(keys));
+}
+
+TEST_CASE("StaticRouter - dispatch", "[http][router]")
+{
+    const StaticRouter router{
+        route<"GET", "/">(reply("root")),
+        route<"GET", "/users">(reply("list")),
+        route<"POST", "/users">(reply("create")),
+        route<"GET", "/users/me">(reply("me")),
+        route<"GET", "/users/:id">([](const HttpRequest& t_request, const Context& /*unused*/) {
+            return HttpResponse::ok("user " + t_request.path_params.at("id"));
+        }),
+        route<"*", "/static/*">(reply("static")),
+    };
+    const Context context;
+
+    SECTION("Static routes are found by method and path")
+    {
+        REQUIRE(router.route(request("GET", "/"), context).body == "root");
+        REQUIRE(router.route(request("GET", "/users"), context).body == "list");
+        REQUIRE(router.route(request("POST", "/users"), context).body == "create");
+        REQUIRE(router.route(request("GET", "/users?page=2"), context).body == "list");
+    }
+
+    SECTION("Static routes win over parameters")
+    {
+        REQUIRE(router.route(request("GET", "/users/me"), context).body == "me");
+        REQUIRE(router.route(request("GET", "/users/42"), context).body == "user 42");
+    }
+
+    SECTION("Wildcards accept every method")
+    {
+        REQUIRE(router.route(request("DELETE", "/static/css/site.css"), context).body == "static");
+    }
+
+    SECTION("Misses are 404")
+    {
+        REQUIRE(router.route(request("DELETE", "/users"), context).status_code == 404);
+        REQUIRE(router.route(request("GET", "/users/42/orders"), context).status_code == 404);
+        REQUIRE(router.route(request("GET", "/nope"), context).status_code == 404);
+    }
+}
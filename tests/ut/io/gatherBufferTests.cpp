@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/io/gatherBuffer.hpp>
+
+#include <memory>
+#include <string>
+
+namespace
+{
+using zephyr::io::GatherBuffer;
+
+// One segment of each kind: "HTTP/1.1 200 OK\r\n" + "Content-Length: 5\r\n\r\n" + "hello"
+auto response() -> GatherBuffer
+{
+    GatherBuffer buffer;
+    buffer.append_static("HTTP/1.1 200 OK\r\n");
+    buffer.append_shared(std::make_shared<const std::string>("Content-Length: 5\r\n\r\n"));
+    buffer.append(std::string{"hello"});
+    return buffer;
+}
+}
+
+TEST_CASE("GatherBuffer - batching", "[io][gather_buffer]")
+{
+    GatherBuffer batch;
+    batch.append(response());
+    batch.append(response());
+
+    REQUIRE(batch.segment_count() == 6);
+    REQUIRE(batch.vectors().size() == 6);
+    REQUIRE(batch.flatten() == response().flatten() + response().flatten());
+
+    SECTION("Past the segment limit bytes are copied onto the last segment")
+    {
+        for (std::size_t i = 0; i < GatherBuffer::MAX_SEGMENTS; ++i) {
+            batch.append_static("x");
+        }
+
+        REQUIRE(batch.segment_count() == GatherBuffer::MAX_SEGMENTS);
+        REQUIRE(batch.size() == 2 * response().size() + GatherBuffer::MAX_SEGMENTS);
+    }
+}
+
+TEST_CASE("GatherBuffer - partial writes", "[io][gather_buffer]")
+{
+    auto buffer = response();
+    const auto whole = buffer.flatten();
+
+    SECTION("Written segments are dropped")
+    {
+        buffer.consume(buffer.segment(0).size());
+        REQUIRE(buffer.segment_count() == 2);
+        REQUIRE(buffer.flatten() == whole.substr(17));
+    }
+
+    SECTION("A segment cut in two keeps its tail, whatever its kind")
+    {
+        for (std::size_t cut : {5, 20, 42}) {
+            auto copy = response();
+            copy.consume(cut);
+            REQUIRE(copy.flatten() == whole.substr(cut));
+            REQUIRE(copy.vectors().size() == copy.segment_count());
+        }
+    }
+
+    SECTION("A shared segment cut in two is not copied")
+    {
+        auto body = std::make_shared<const std::string>(4096, 'b');
+        GatherBuffer cached;
+        cached.append_static("HTTP/1.1 200 OK\r\n");
+        cached.append_shared(body);
+
+        cached.consume(17 + 1000);
+        cached.consume(1000);
+        REQUIRE(cached.segment_count() == 1);
+        REQUIRE(cached.segment(0).data() == body->data() + 2000);
+        REQUIRE(cached.vectors()[0].iov_base == body->data() + 2000);
+        REQUIRE(cached.size() == 2096);
+
+        GatherBuffer batch;
+        batch.append_static("x");
+        batch.append(std::move(cached));
+        REQUIRE(batch.flatten() == "x" + body->substr(2000));
+    }
+
+    SECTION("Consuming everything empties the buffer")
+    {
+        buffer.consume(whole.size());
+        REQUIRE(buffer.empty());
+        REQUIRE(buffer.size() == 0);
+    }
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexec/execution.hpp>
+#include <zephyr/io/ioUringContext.hpp>
+
+#include <chrono>
+
+namespace
+{
+using zephyr::io::IoUringContext;
+using namespace std::chrono_literals;
+
+enum class Outcome
+{
+    pending,
+    fired,
+    stopped
+};
+
+// Looks unstopped when the operation checks it, but the stop lands while the operation registers
+// its callback: the window between that check and the timer being scheduled
+struct LateStopToken
+{
+    template <typename Callback>
+    struct CallbackType
+    {
+        CallbackType(LateStopToken /*unused*/, Callback t_callback) noexcept
+        {
+            t_callback();
+        }
+    };
+
+    template <typename Callback>
+    using callback_type = CallbackType<Callback>;
+
+    [[nodiscard]] auto stop_requested() const noexcept -> bool
+    {
+        return false;
+    }
+
+    [[nodiscard]] auto stop_possible() const noexcept -> bool
+    {
+        return true;
+    }
+
+    auto operator==(const LateStopToken&) const noexcept -> bool = default;
+};
+
+template <typename Token>
+struct TimerReceiver
+{
+    using receiver_concept = stdexec::receiver_t;
+
+    struct Env
+    {
+        Token token;
+
+        [[nodiscard]] auto query(stdexec::get_stop_token_t /*unused*/) const noexcept -> Token
+        {
+            return token;
+        }
+    };
+
+    Token token;
+    Outcome* outcome;
+
+    void set_value() noexcept
+    {
+        *outcome = Outcome::fired;
+    }
+
+    void set_stopped() noexcept
+    {
+        *outcome = Outcome::stopped;
+    }
+
+    [[nodiscard]] auto get_env() const noexcept -> Env
+    {
+        return {token};
+    }
+};
+}
+
+TEST_CASE("IoUringContext - timer cancellation", "[io][io_uring_context]")
+{
+    IoUringContext context;
+    auto outcome = Outcome::pending;
+
+    SECTION("A stop that comes before the timer is scheduled is not lost")
+    {
+        auto operation = stdexec::connect(context.schedule_after(1h), TimerReceiver<LateStopToken>{{}, &outcome});
+        stdexec::start(operation);
+
+        REQUIRE(outcome == Outcome::stopped);
+    }
+
+    SECTION("A stop removes a scheduled timer")
+    {
+        stdexec::inplace_stop_source source;
+        auto operation = stdexec::connect(context.schedule_after(1h),
+                                          TimerReceiver<stdexec::inplace_stop_token>{source.get_token(), &outcome});
+        stdexec::start(operation);
+        REQUIRE(outcome == Outcome::pending);
+
+        source.request_stop();
+        REQUIRE(outcome == Outcome::stopped);
+    }
+}
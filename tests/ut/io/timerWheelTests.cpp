@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/io/timerWheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using zephyr::io::ExpiredTimer;
+using zephyr::io::TimerNode;
+using zephyr::io::TimerWheel;
+using namespace std::chrono_literals;
+
+const auto start = TimerWheel::Clock::time_point{} + 1h;
+
+auto at(std::chrono::milliseconds t_offset) -> TimerWheel::Clock::time_point
+{
+    return start + t_offset;
+}
+
+auto expire_until(TimerWheel& t_wheel, std::chrono::milliseconds t_offset) -> std::vector<ExpiredTimer>
+{
+    std::vector<ExpiredTimer> expired;
+    t_wheel.advance(at(t_offset), expired);
+    return expired;
+}
+}
+
+TEST_CASE("TimerWheel - expiry", "[io][timer_wheel]")
+{
+    TimerWheel wheel{1ms, start};
+
+    SECTION("A timer fires on its tick and not before")
+    {
+        TimerNode node;
+        const auto generation = wheel.schedule(node, at(10ms));
+        REQUIRE(node.is_scheduled());
+        REQUIRE(wheel.size() == 1);
+        REQUIRE(wheel.next_wakeup() == at(10ms));
+
+        REQUIRE(expire_until(wheel, 9ms).empty());
+
+        auto expired = expire_until(wheel, 10ms);
+        REQUIRE(expired.size() == 1);
+        REQUIRE(expired[0].node == &node);
+        REQUIRE(expired[0].generation == generation);
+        REQUIRE_FALSE(node.is_scheduled());
+        REQUIRE(wheel.empty());
+        REQUIRE_FALSE(wheel.next_wakeup());
+    }
+
+    SECTION("Deadlines between ticks are rounded up, past ones fire on the next tick")
+    {
+        TimerNode between;
+        TimerNode past;
+        wheel.schedule(between, at(5ms) + 100us);
+        expire_until(wheel, 3ms);
+        wheel.schedule(past, at(1ms));
+
+        auto expired = expire_until(wheel, 5ms);
+        REQUIRE(expired.size() == 1);
+        REQUIRE(expired[0].node == &past);
+
+        REQUIRE(expire_until(wheel, 6ms).size() == 1);
+    }
+
+    SECTION("Timers on the coarser wheels come down and fire in deadline order")
+    {
+        std::vector<TimerNode> nodes(4);
+        const std::vector<std::chrono::milliseconds> deadlines{70'000ms, 300ms, 20'000'000ms, 5'000ms};
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            wheel.schedule(nodes[i], at(deadlines[i]));
+        }
+
+        std::vector<TimerNode*> order;
+        auto now = 0ms;
+        while (!wheel.empty()) {
+            // Sleeping until the advertised wakeup is enough to never miss a deadline
+            const auto wakeup = *wheel.next_wakeup();
+            REQUIRE(wakeup > at(now));
+            now = std::chrono::duration_cast<std::chrono::milliseconds>(wakeup - start);
+
+            for (auto [node, generation] : expire_until(wheel, now)) {
+                REQUIRE(now == deadlines[static_cast<std::size_t>(node - nodes.data())]);
+                order.push_back(node);
+            }
+        }
+
+        REQUIRE(order == std::vector<TimerNode*>{&nodes[1], &nodes[3], &nodes[0], &nodes[2]});
+    }
+
+    SECTION("Deadlines past the wheels' range wait at the top and still fire on time")
+    {
+        TimerNode node;
+        const auto deadline = std::chrono::milliseconds{100h};
+        wheel.schedule(node, at(deadline));
+
+        REQUIRE(expire_until(wheel, deadline - 1ms).empty());
+        REQUIRE(expire_until(wheel, deadline).size() == 1);
+    }
+}
+
+TEST_CASE("TimerWheel - cancel and reschedule", "[io][timer_wheel]")
+{
+    TimerWheel wheel{1ms, start};
+    TimerNode first;
+    TimerNode second;
+    wheel.schedule(first, at(50ms));
+    const auto generation = wheel.schedule(second, at(50ms));
+
+    SECTION("A cancelled timer never fires")
+    {
+        REQUIRE(wheel.cancel(first));
+        REQUIRE_FALSE(wheel.cancel(first));
+
+        auto expired = expire_until(wheel, 50ms);
+        REQUIRE(expired.size() == 1);
+        REQUIRE(expired[0].node == &second);
+        REQUIRE_FALSE(wheel.cancel(second));
+    }
+
+    SECTION("Scheduling again moves the timer and changes its generation")
+    {
+        REQUIRE(wheel.schedule(second, at(500ms)) != generation);
+        REQUIRE(wheel.size() == 2);
+
+        REQUIRE(expire_until(wheel, 50ms).size() == 1);
+        REQUIRE(expire_until(wheel, 499ms).empty());
+        REQUIRE(expire_until(wheel, 500ms).size() == 1);
+    }
+
+    SECTION("Clearing hands back every timer")
+    {
+        std::vector<ExpiredTimer> dropped;
+        wheel.clear(dropped);
+        REQUIRE(dropped.size() == 2);
+        REQUIRE(wheel.empty());
+        REQUIRE_FALSE(first.is_scheduled());
+    }
+}
+
+TEST_CASE("TimerWheel - many timers", "[io][timer_wheel]")
+{
+    TimerWheel wheel{1ms, start};
+    std::vector<TimerNode> nodes(20'000);
+    std::vector<std::chrono::milliseconds> deadlines(nodes.size());
+
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int64_t> spread{1, 3'000'000};
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        deadlines[i] = std::chrono::milliseconds{spread(random)};
+        wheel.schedule(nodes[i], at(deadlines[i]));
+    }
+
+    // Every other one is cancelled
+    for (std::size_t i = 0; i < nodes.size(); i += 2) {
+        REQUIRE(wheel.cancel(nodes[i]));
+    }
+    REQUIRE(wheel.size() == nodes.size() / 2);
+
+    std::size_t fired = 0;
+    bool on_time = true;
+    while (!wheel.empty()) {
+        const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(*wheel.next_wakeup() - start);
+        for (auto [node, generation] : expire_until(wheel, now)) {
+            const auto index = static_cast<std::size_t>(node - nodes.data());
+            on_time = on_time && index % 2 == 1 && deadlines[index] == now;
+            ++fired;
+        }
+    }
+
+    REQUIRE(on_time);
+    REQUIRE(fired == nodes.size() / 2);
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/plugins/udpServer/details/batch.hpp>
+#include <zephyr/plugins/udpServer/details/protocol.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+namespace
+{
+using zephyr::plugins::udp::PacketView;
+using zephyr::plugins::udp::details::appendPackets;
+}
+
+TEST_CASE("ReceiveBatch - GRO aggregates", "[plugins][udp][batch]")
+{
+    std::vector<char> payload(250, 'x');
+    sockaddr_in peer{};
+    peer.sin_family = AF_INET;
+    const auto* source = reinterpret_cast<const sockaddr*>(&peer);
+
+    std::vector<PacketView> packets;
+
+    SECTION("A plain datagram is one packet")
+    {
+        appendPackets(packets, payload, source, sizeof(peer), 0);
+
+        REQUIRE(packets.size() == 1);
+        REQUIRE(packets[0].payload.data() == payload.data());
+        REQUIRE(packets[0].payload.size() == payload.size());
+    }
+
+    SECTION("An aggregate is split at the segment size, the last segment keeping the rest")
+    {
+        appendPackets(packets, payload, source, sizeof(peer), 100);
+
+        REQUIRE(packets.size() == 3);
+        for (std::size_t i = 0; i < packets.size(); ++i) {
+            REQUIRE(packets[i].payload.data() == payload.data() + (i * 100));
+            REQUIRE(packets[i].source == source);
+            REQUIRE(packets[i].sourceLength == sizeof(peer));
+        }
+        REQUIRE(packets[0].payload.size() == 100);
+        REQUIRE(packets[1].payload.size() == 100);
+        REQUIRE(packets[2].payload.size() == 50);
+    }
+
+    SECTION("Segments that divide the aggregate evenly are all full")
+    {
+        appendPackets(packets, std::span{payload}.first(200), source, sizeof(peer), 100);
+
+        REQUIRE(packets.size() == 2);
+        REQUIRE(packets[1].payload.size() == 100);
+    }
+
+    SECTION("A segment size covering the whole payload leaves it in one piece")
+    {
+        appendPackets(packets, payload, source, sizeof(peer), payload.size());
+
+        REQUIRE(packets.size() == 1);
+    }
+
+    SECTION("Packets are appended behind the ones already in the batch")
+    {
+        appendPackets(packets, payload, source, sizeof(peer), 0);
+        appendPackets(packets, payload, source, sizeof(peer), 125);
+
+        REQUIRE(packets.size() == 3);
+        REQUIRE(packets[2].payload.data() == payload.data() + 125);
+    }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/network/addressV4.hpp>
+#include <zephyr/network/endpoint.hpp>
+#include <zephyr/network/udpSocket.hpp>
+#include <zephyr/plugins/udpServer/details/batch.hpp>
+#include <zephyr/plugins/udpServer/details/concept.hpp>
+#include <zephyr/plugins/udpServer/details/protocol.hpp>
+#include <zephyr/plugins/udpServer/details/responseSink.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+namespace
+{
+using namespace zephyr::plugins::udp;
+using zephyr::network::AddressV4;
+using zephyr::network::UdpEndpoint;
+using zephyr::network::UdpSocket;
+
+// Keeps what every call was given
+struct BatchController
+{
+    std::vector<std::vector<PacketView>> batches;
+
+    auto onMessages(std::span<PacketView> t_packets, ResponseSink& /*unused*/) -> void
+    {
+        batches.emplace_back(t_packets.begin(), t_packets.end());
+    }
+};
+
+// Echoes every packet
+struct EchoController
+{
+    std::size_t calls{0};
+
+    auto onMessage(std::span<char> t_payload) -> UdpProtocol::OutputType
+    {
+        ++calls;
+        return std::vector<uint8_t>(t_payload.begin(), t_payload.end());
+    }
+};
+
+struct WrongReturn
+{
+    auto onMessages(std::span<PacketView> /*unused*/, ResponseSink& /*unused*/) -> int
+    {
+        return 0;
+    }
+};
+
+struct NoHandler
+{};
+
+static_assert(HasOnMessages<BatchController>);
+static_assert(!HasOnMessage<BatchController>);
+static_assert(ControllerConcept<BatchController>);
+static_assert(HasOnMessage<EchoController>);
+static_assert(!HasOnMessages<EchoController>);
+static_assert(ControllerConcept<EchoController>);
+static_assert(!HasOnMessages<WrongReturn>);
+static_assert(!ControllerConcept<WrongReturn>);
+static_assert(!ControllerConcept<NoHandler>);
+}
+
+TEST_CASE("Controller - batched delivery", "[plugins][udp][controller]")
+{
+    UdpSocket socket{UdpEndpoint{AddressV4::loopback(), 9000}};
+    ResponseSink sink{socket, 8, 64};
+
+    std::vector<char> aggregate(100, 'a');
+    std::vector<char> single(30, 's');
+    sockaddr_in first{};
+    first.sin_family = AF_INET;
+    first.sin_port = htons(4000);
+    sockaddr_in second{};
+    second.sin_family = AF_INET;
+    second.sin_port = htons(4001);
+
+    // A GRO aggregate of 40-byte segments from one peer and a plain datagram from another
+    std::vector<PacketView> packets;
+    details::appendPackets(packets, aggregate, reinterpret_cast<const sockaddr*>(&first), sizeof(first), 40);
+    details::appendPackets(packets, single, reinterpret_cast<const sockaddr*>(&second), sizeof(second), 0);
+
+    SECTION("The whole batch reaches onMessages in one call, views unchanged")
+    {
+        BatchController controller;
+        deliverPackets(controller, std::span{packets}, sink);
+
+        REQUIRE(controller.batches.size() == 1);
+        const auto& batch = controller.batches.front();
+        REQUIRE(batch.size() == 4);
+
+        for (std::size_t i = 0; i < 3; ++i) {
+            REQUIRE(batch[i].payload.data() == aggregate.data() + (i * 40));
+            REQUIRE(batch[i].sourceEndpoint().port() == 4000);
+        }
+        REQUIRE(batch[2].payload.size() == 20);
+        REQUIRE(batch[3].payload.data() == single.data());
+        REQUIRE(batch[3].payload.size() == 30);
+        REQUIRE(batch[3].sourceEndpoint().port() == 4001);
+        REQUIRE(sink.size() == 0);
+    }
+
+    SECTION("A per-packet controller is called for each packet and its replies are queued")
+    {
+        EchoController controller;
+        deliverPackets(controller, std::span{packets}, sink);
+
+        REQUIRE(controller.calls == 4);
+        REQUIRE(sink.size() == 4);
+    }
+}
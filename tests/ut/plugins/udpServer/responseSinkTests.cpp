@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/network/udpSocket.hpp>
+#include <zephyr/plugins/udpServer/details/responseSink.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace
+{
+using zephyr::network::UdpSocket;
+using zephyr::plugins::udp::ResponseSink;
+
+// Largest IPv4 payload under a 1500-byte MTU
+constexpr std::size_t mtuSegment = 1472;
+
+// Committed replies as the sink hands them to sendmmsg: one iovec each, the peer told by its port
+class Replies
+{
+public:
+    explicit Replies(std::vector<std::pair<std::size_t, uint16_t>> t_replies)
+        : m_peers(t_replies.size()),
+          m_vectors(t_replies.size()),
+          m_headers(t_replies.size())
+    {
+        for (std::size_t i = 0; i < t_replies.size(); ++i) {
+            m_peers[i].sin_family = AF_INET;
+            m_peers[i].sin_port = htons(t_replies[i].second);
+            m_peers[i].sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            m_vectors[i].iov_len = t_replies[i].first;
+            m_headers[i].msg_hdr.msg_name = &m_peers[i];
+            m_headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            m_headers[i].msg_hdr.msg_iov = &m_vectors[i];
+            m_headers[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    // The replies each GSO send carries, flushing them the way the sink does
+    auto runs(std::size_t t_maxSegment = mtuSegment) const -> std::vector<std::size_t>
+    {
+        std::vector<std::size_t> runs;
+        for (std::size_t first = 0; first < m_headers.size();) {
+            runs.push_back(ResponseSink::segmentRun(std::span{m_headers}.subspan(first), t_maxSegment));
+            first += runs.back();
+        }
+        return runs;
+    }
+
+private:
+    std::vector<sockaddr_in> m_peers;
+    std::vector<iovec> m_vectors;
+    std::vector<mmsghdr> m_headers;
+};
+
+auto sameSize(std::size_t t_count, std::size_t t_size, uint16_t t_port = 9000) -> Replies
+{
+    return Replies{std::vector<std::pair<std::size_t, uint16_t>>(t_count, {t_size, t_port})};
+}
+}
+
+TEST_CASE("ResponseSink - GSO segment runs", "[plugins][udp][response_sink]")
+{
+    SECTION("Equal replies to one peer go out together, closed by a shorter last one")
+    {
+        REQUIRE(Replies{{{100, 9000}, {100, 9000}, {100, 9000}, {60, 9000}}}.runs() == std::vector<std::size_t>{4});
+    }
+
+    SECTION("A shorter reply ends the run even when longer ones follow")
+    {
+        REQUIRE(Replies{{{100, 9000}, {60, 9000}, {100, 9000}, {100, 9000}}}.runs()
+                == std::vector<std::size_t>{2, 2});
+    }
+
+    SECTION("A longer reply starts a run of its own")
+    {
+        REQUIRE(Replies{{{60, 9000}, {100, 9000}, {100, 9000}}}.runs() == std::vector<std::size_t>{1, 2});
+    }
+
+    SECTION("Segments up to the MTU are merged, larger ones are sent alone")
+    {
+        REQUIRE(sameSize(8, mtuSegment).runs() == std::vector<std::size_t>{8});
+        REQUIRE(sameSize(3, mtuSegment + 1).runs() == std::vector<std::size_t>{1, 1, 1});
+    }
+
+    SECTION("A run stops at the segment and byte limits of one send")
+    {
+        const auto segments = sameSize(UdpSocket::MAX_GSO_SEGMENTS + 6, 10).runs();
+        REQUIRE(segments == std::vector<std::size_t>{UdpSocket::MAX_GSO_SEGMENTS, 6});
+
+        // 44 * 1472 is the most that fits in 65507 bytes
+        const auto bytes = sameSize(50, mtuSegment).runs();
+        REQUIRE(bytes == std::vector<std::size_t>{44, 6});
+    }
+
+    SECTION("A reply to another peer breaks the run")
+    {
+        REQUIRE(Replies{{{100, 9000}, {100, 9000}, {100, 9001}, {100, 9000}, {100, 9000}}}.runs()
+                == std::vector<std::size_t>{2, 1, 2});
+    }
+
+    SECTION("Empty replies are never merged")
+    {
+        REQUIRE(Replies{{{100, 9000}, {0, 9000}, {0, 9000}}}.runs() == std::vector<std::size_t>{1, 1, 1});
+    }
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <zephyr/tcp/admissionControl.hpp>
+
+#include <cstddef>
+
+namespace
+{
+using zephyr::tcp::AcceptChange;
+using zephyr::tcp::AdmissionControl;
+using zephyr::tcp::AdmissionLimits;
+
+constexpr in_addr_t first_peer = 0x0100007f;
+constexpr in_addr_t second_peer = 0x0200007f;
+}
+
+TEST_CASE("AdmissionControl - admission", "[tcp][admission]")
+{
+    SECTION("Connections are refused at the cap and taken again below it")
+    {
+        AdmissionControl admission{{.max_connections = 2, .max_queued_sessions = 0}};
+
+        REQUIRE(admission.admit(0, first_peer));
+        REQUIRE(admission.admit(1, first_peer));
+        REQUIRE_FALSE(admission.admit(2, first_peer));
+        REQUIRE(admission.admit(1, second_peer));
+        REQUIRE_FALSE(admission.tracks_sources());
+    }
+
+    SECTION("Each source has its own limit, freed as its connections go")
+    {
+        AdmissionControl admission{{.max_connections = 0, .max_connections_per_source = 2}};
+
+        REQUIRE(admission.admit(0, first_peer));
+        REQUIRE(admission.admit(1, first_peer));
+        REQUIRE_FALSE(admission.admit(2, first_peer));
+        REQUIRE(admission.connections_from(first_peer) == 2);
+
+        REQUIRE(admission.admit(2, second_peer));
+        REQUIRE(admission.connections_from(second_peer) == 1);
+
+        admission.forget(first_peer);
+        REQUIRE(admission.connections_from(first_peer) == 1);
+        REQUIRE(admission.admit(2, first_peer));
+
+        admission.forget(second_peer);
+        admission.forget(second_peer);
+        REQUIRE(admission.connections_from(second_peer) == 0);
+    }
+
+    SECTION("Zero turns the limits off")
+    {
+        AdmissionControl admission{{.max_connections = 0, .max_connections_per_source = 0, .max_queued_sessions = 0}};
+
+        REQUIRE(admission.admit(1'000'000, first_peer));
+        REQUIRE(admission.update(1'000'000, 1'000'000) == AcceptChange::none);
+        REQUIRE_FALSE(admission.paused());
+    }
+}
+
+TEST_CASE("AdmissionControl - pausing and resuming", "[tcp][admission]")
+{
+    AdmissionControl admission{{.max_connections = 10, .max_queued_sessions = 8}};
+
+    SECTION("Queued sessions pause accepting, which resumes at half the limit")
+    {
+        REQUIRE(admission.update(1, 7) == AcceptChange::none);
+        REQUIRE(admission.update(1, 8) == AcceptChange::paused);
+        REQUIRE(admission.paused());
+
+        // Between the two thresholds nothing changes either way
+        REQUIRE(admission.update(1, 8) == AcceptChange::none);
+        REQUIRE(admission.update(1, 5) == AcceptChange::none);
+        REQUIRE(admission.update(1, 4) == AcceptChange::none);
+        REQUIRE(admission.paused());
+
+        REQUIRE(admission.update(1, 3) == AcceptChange::resumed);
+        REQUIRE_FALSE(admission.paused());
+        REQUIRE(admission.update(1, 7) == AcceptChange::none);
+    }
+
+    SECTION("The connection cap pauses accepting until a connection goes")
+    {
+        REQUIRE(admission.update(9, 0) == AcceptChange::none);
+        REQUIRE(admission.update(10, 0) == AcceptChange::paused);
+        REQUIRE(admission.update(10, 0) == AcceptChange::none);
+        REQUIRE(admission.update(9, 0) == AcceptChange::resumed);
+    }
+
+    SECTION("A paused server stays paused while either limit holds")
+    {
+        REQUIRE(admission.update(10, 8) == AcceptChange::paused);
+        REQUIRE(admission.update(10, 0) == AcceptChange::none);
+        REQUIRE(admission.update(2, 6) == AcceptChange::none);
+        REQUIRE(admission.update(2, 1) == AcceptChange::resumed);
+    }
+
+    SECTION("A queue limit of one still pauses")
+    {
+        AdmissionControl tight{{.max_connections = 0, .max_queued_sessions = 1}};
+
+        REQUIRE(tight.update(0, 1) == AcceptChange::paused);
+        REQUIRE(tight.update(0, 1) == AcceptChange::none);
+        REQUIRE(tight.update(0, 0) == AcceptChange::resumed);
+    }
+}
@@ -16,6 +16,8 @@ class UdpServer {
     std::shared_ptr<zephyr::io::IoUringContext> io_ctx_;
     std::shared_ptr<zephyr::context::Context> context_;
     std::atomic<bool> is_running_{true};
+    std::array<std::byte, 65536> receive_buffer_{};
+    sockaddr_in client_addr_{};
     
 public:
     UdpServer(Scheduler sched, PipelineFactory factory,
@@ -49,7 +51,7 @@ public:
     
     void stop() {
         is_running_.store(false);
-        io_ctx_->cancel();
+        io_ctx_->stop();
         if (socket_fd_ >= 0) {
             ::close(socket_fd_);
             socket_fd_ = -1;
@@ -60,68 +62,69 @@ private:
     void receive_loop() {
         if (!is_running_.load()) return;
         
-        auto work = stdexec::schedule(scheduler_)
-            | stdexec::then([this]() -> std::optional<std::pair<zephyr::udp::UdpProtocol::InputType, sockaddr_in>> {
-                if (!is_running_.load()) return std::nullopt;
-                
-                std::array<std::byte, 65536> buffer;
-                sockaddr_in client_addr{};
-                
-                auto n = io_ctx_->recvfrom(socket_fd_, buffer, client_addr);
-                if (!is_running_.load() || n <= 0) return std::nullopt;
+        auto work = io_ctx_->recvfrom(socket_fd_, receive_buffer_, client_addr_)
+            | stdexec::then([this](std::size_t n) {
+                if (!is_running_.load()) return;
                 
-                // Get local port
-                sockaddr_in local_addr{};
-                socklen_t len = sizeof(local_addr);
-                getsockname(socket_fd_, reinterpret_cast<sockaddr*>(&local_addr), &len);
-                
-                zephyr::udp::UdpProtocol::InputType packet{
-                    .data = {reinterpret_cast<uint8_t*>(buffer.data()),
-                             reinterpret_cast<uint8_t*>(buffer.data()) + n},
-                    .source_ip = inet_ntoa(client_addr.sin_addr),
-                    .source_port = ntohs(client_addr.sin_port),
-                    .dest_port = ntohs(local_addr.sin_port),
-                    .client_addr = client_addr
-                };
-                
-                std::cout << "[UDP Server] Received " << n << " bytes from "
-                          << packet.source_ip << ":" << packet.source_port << "\n";
+                if (n > 0) {
+                    // Get local port
+                    sockaddr_in local_addr{};
+                    socklen_t len = sizeof(local_addr);
+                    getsockname(socket_fd_, reinterpret_cast<sockaddr*>(&local_addr), &len);
+                    
+                    zephyr::udp::UdpProtocol::InputType packet{
+                        .data = {reinterpret_cast<uint8_t*>(receive_buffer_.data()),
+                                 reinterpret_cast<uint8_t*>(receive_buffer_.data()) + n},
+                        .source_ip = inet_ntoa(client_addr_.sin_addr),
+                        .source_port = ntohs(client_addr_.sin_port),
+                        .dest_port = ntohs(local_addr.sin_port),
+                        .client_addr = client_addr_
+                    };
+                    
+                    std::cout << "[UDP Server] Received " << n << " bytes from "
+                              << packet.source_ip << ":" << packet.source_port << "\n";
+                    
+                    process(std::move(packet));
+                }
                 
-                return std::make_pair(std::move(packet), client_addr);
+                // The buffer has been copied out, so the next datagram can be received
+                receive_loop();
+            })
+            | stdexec::upon_error([this](std::exception_ptr e) {
+                try { std::rethrow_exception(e); }
+                catch (const std::exception& ex) {
+                    std::cout << "[UDP Server] Error: " << ex.what() << "\n";
+                }
+                if (is_running_.load()) receive_loop();
+            });
+        
+        stdexec::start_detached(std::move(work));
+    }
+    
+    void process(zephyr::udp::UdpProtocol::InputType packet) {
+        auto addr = packet.client_addr;
+        
+        auto work = stdexec::schedule(scheduler_)
+            | stdexec::let_value([this, packet = std::move(packet)]() mutable {
+                return pipeline_(std::move(packet), context_);
             })
-            | stdexec::let_value([this](auto maybe_packet) {
-                using Result = std::optional<std::pair<std::vector<uint8_t>, sockaddr_in>>;
-                using Sender = zephyr::common::ResultSender<Result>;
+            | stdexec::let_value([this, addr](zephyr::udp::UdpProtocol::OutputType& response) {
+                using Sender = zephyr::common::ResultSender<std::size_t>;
                 
-                if (!maybe_packet) return Sender{stdexec::just(Result{})};
+                if (!response || response->empty()) return Sender{stdexec::just(std::size_t{0})};
                 
-                auto [packet, addr] = std::move(*maybe_packet);
-                return Sender{
-                    pipeline_(std::move(packet), context_)
-                        | stdexec::then([addr](zephyr::udp::UdpProtocol::OutputType response) -> Result {
-                            if (response && !response->empty()) {
-                                return std::make_pair(std::move(*response), addr);
-                            }
-                            return std::nullopt;
-                        })
-                };
+                return Sender{io_ctx_->sendto(socket_fd_,
+                    std::span<const std::byte>{reinterpret_cast<const std::byte*>(response->data()), response->size()},
+                    addr)};
             })
-            | stdexec::then([this](auto maybe_response) {
-                if (maybe_response) {
-                    auto& [data, addr] = *maybe_response;
-                    auto sent = io_ctx_->sendto(socket_fd_,
-                        std::span<const std::byte>{reinterpret_cast<const std::byte*>(data.data()), data.size()},
-                        addr);
-                    std::cout << "[UDP Server] Sent " << sent << " bytes\n";
-                }
-                if (is_running_.load()) receive_loop();
+            | stdexec::then([](std::size_t sent) {
+                if (sent > 0) std::cout << "[UDP Server] Sent " << sent << " bytes\n";
             })
-            | stdexec::upon_error([this](std::exception_ptr e) {
+            | stdexec::upon_error([](std::exception_ptr e) {
                 try { std::rethrow_exception(e); }
                 catch (const std::exception& ex) {
                     std::cout << "[UDP Server] Error: " << ex.what() << "\n";
                 }
-                if (is_running_.load()) receive_loop();
             });
         
         stdexec::start_detached(std::move(work));
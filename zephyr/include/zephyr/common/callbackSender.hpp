@@ -0,0 +1,85 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <stdexec/execution.hpp>
+
+namespace zephyr::common
+{
+// Called once with either an error or the value; it may be called from any thread, and before the
+// start function returns
+template<typename T>
+using Completion = std::function<void(std::exception_ptr, std::optional<T>)>;
+
+namespace details
+{
+template<typename T, typename Start, typename Receiver>
+class CallbackOperation
+{
+public:
+    CallbackOperation(Start t_start, Receiver t_receiver)
+        : m_start(std::move(t_start)), m_receiver(std::move(t_receiver)) {}
+
+    CallbackOperation(const CallbackOperation&) = delete;
+    CallbackOperation(CallbackOperation&&) = delete;
+    CallbackOperation& operator=(const CallbackOperation&) = delete;
+    CallbackOperation& operator=(CallbackOperation&&) = delete;
+
+    friend void tag_invoke(stdexec::start_t /*unused*/, CallbackOperation& t_self) noexcept
+    {
+        t_self.start();
+    }
+
+private:
+    auto start() noexcept -> void
+    {
+        try {
+            m_start(Completion<T>{[this](std::exception_ptr t_error, std::optional<T> t_value) {
+                if (t_error) {
+                    stdexec::set_error(std::move(m_receiver), std::move(t_error));
+                } else {
+                    stdexec::set_value(std::move(m_receiver), std::move(*t_value));
+                }
+            }});
+        } catch (...) {
+            stdexec::set_error(std::move(m_receiver), std::current_exception());
+        }
+    }
+
+    Start m_start;
+    Receiver m_receiver;
+};
+}
+
+// Adapts a callback-based API to a sender: on start, the start function is handed a Completion that
+// finishes the operation. Used where the other side is not a sender, such as a Rendezvous.
+template<typename T, typename Start>
+class CallbackSender
+{
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(T),
+                                                                 stdexec::set_error_t(std::exception_ptr)>;
+
+    explicit CallbackSender(Start t_start) : m_start(std::move(t_start)) {}
+
+    template<stdexec::receiver Receiver>
+    friend auto tag_invoke(stdexec::connect_t /*unused*/, CallbackSender&& t_self, Receiver t_receiver)
+    {
+        return details::CallbackOperation<T, Start, Receiver>{std::move(t_self.m_start), std::move(t_receiver)};
+    }
+
+private:
+    Start m_start;
+};
+
+template<typename T, typename Start>
+auto from_callback(Start t_start) -> CallbackSender<T, std::decay_t<Start>>
+{
+    return CallbackSender<T, std::decay_t<Start>>{std::move(t_start)};
+}
+}
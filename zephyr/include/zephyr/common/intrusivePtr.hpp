@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace zephyr::common
+{
+// Shared ownership through a count kept in the object itself: T provides add_ref() and release(),
+// and decides in release() what happens to it when the count reaches zero. Unlike std::shared_ptr
+// there is no control block, so the object can live in storage it does not own, like a Slab.
+template<typename T>
+class IntrusivePtr
+{
+public:
+    IntrusivePtr() noexcept = default;
+
+    // Takes a new reference to t_object
+    explicit IntrusivePtr(T* t_object) noexcept
+        : m_object(t_object)
+    {
+        if (m_object) {
+            m_object->add_ref();
+        }
+    }
+
+    // Adopts a reference the caller already holds
+    static auto adopt(T* t_object) noexcept
+        -> IntrusivePtr
+    {
+        IntrusivePtr ptr;
+        ptr.m_object = t_object;
+        return ptr;
+    }
+
+    IntrusivePtr(const IntrusivePtr& t_other) noexcept
+        : IntrusivePtr(t_other.m_object) {}
+
+    IntrusivePtr(IntrusivePtr&& t_other) noexcept
+        : m_object(std::exchange(t_other.m_object, nullptr)) {}
+
+    IntrusivePtr& operator=(IntrusivePtr t_other) noexcept
+    {
+        std::swap(m_object, t_other.m_object);
+        return *this;
+    }
+
+    IntrusivePtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    ~IntrusivePtr()
+    {
+        reset();
+    }
+
+    auto reset() noexcept
+        -> void
+    {
+        if (auto* object = std::exchange(m_object, nullptr)) {
+            object->release();
+        }
+    }
+
+    auto get() const noexcept
+        -> T*
+    {
+        return m_object;
+    }
+
+    auto operator->() const noexcept
+        -> T*
+    {
+        return m_object;
+    }
+
+    auto operator*() const noexcept
+        -> T&
+    {
+        return *m_object;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_object != nullptr;
+    }
+
+    friend auto operator==(const IntrusivePtr&, const IntrusivePtr&) -> bool = default;
+
+private:
+    T* m_object = nullptr;
+};
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace zephyr::common
+{
+// Single-slot hand-over between one producer and one consumer on any threads. The producer's
+// resume callback runs only once the consumer has taken the value, which is what gives a stream
+// built on it backpressure: the producer cannot get more than one value ahead.
+// Callbacks run outside the lock, on whichever side completed the hand-over.
+template<typename T>
+class Rendezvous
+{
+public:
+    using Consumer = std::function<void(std::exception_ptr, std::optional<T>)>;
+    using Resume = std::function<void()>;
+
+    // Hands over t_value; t_resume (may be empty) runs once the consumer has it, or right away
+    // when the consumer has gone
+    auto push(T t_value, Resume t_resume)
+        -> void
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_abandoned) {
+            lock.unlock();
+            if (t_resume) {
+                t_resume();
+            }
+            return;
+        }
+
+        if (m_consumer) {
+            auto consumer = std::exchange(m_consumer, nullptr);
+            lock.unlock();
+            consumer(nullptr, std::move(t_value));
+            if (t_resume) {
+                t_resume();
+            }
+            return;
+        }
+
+        m_value.emplace(std::move(t_value));
+        m_resume = std::move(t_resume);
+    }
+
+    // t_consumer runs with the next value, right away when one is waiting, or with the error the
+    // producer failed with
+    auto pull(Consumer t_consumer)
+        -> void
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_value) {
+            auto value = std::move(*m_value);
+            m_value.reset();
+            auto resume = std::exchange(m_resume, nullptr);
+            lock.unlock();
+            t_consumer(nullptr, std::move(value));
+            if (resume) {
+                resume();
+            }
+            return;
+        }
+
+        if (m_error) {
+            auto error = m_error;
+            lock.unlock();
+            t_consumer(error, std::nullopt);
+            return;
+        }
+
+        m_consumer = std::move(t_consumer);
+    }
+
+    // Producer side: no value will come; the waiting and every later pull get t_error
+    auto fail(std::exception_ptr t_error)
+        -> void
+    {
+        std::unique_lock lock(m_mutex);
+        m_error = t_error;
+        auto consumer = std::exchange(m_consumer, nullptr);
+        lock.unlock();
+
+        if (consumer) {
+            consumer(t_error, std::nullopt);
+        }
+    }
+
+    // Consumer side: nothing more will be pulled; a waiting value is dropped and producers resume
+    auto abandon()
+        -> void
+    {
+        std::unique_lock lock(m_mutex);
+        m_abandoned = true;
+        m_value.reset();
+        auto resume = std::exchange(m_resume, nullptr);
+        lock.unlock();
+
+        if (resume) {
+            resume();
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::optional<T> m_value;
+    Resume m_resume;
+    Consumer m_consumer;
+    std::exception_ptr m_error;
+    bool m_abandoned = false;
+};
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace zephyr::common
+{
+// Storage for objects of one type, recycled instead of returned to the allocator. Slots come in
+// pages of t_page_size that never move, so an object keeps its address for its whole life. Every
+// time a slot is freed its generation changes, so a key kept past the object's end is told apart
+// from whatever lives in the slot now. Not synchronized.
+template<typename T, std::size_t PageSize = 256>
+class Slab
+{
+public:
+    struct Key
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+        uint32_t generation = 0;
+
+        friend auto operator==(const Key&, const Key&) -> bool = default;
+    };
+
+    Slab() = default;
+
+    Slab(const Slab&) = delete;
+    Slab& operator=(const Slab&) = delete;
+
+    ~Slab()
+    {
+        for (std::size_t i = 0; i < m_pages.size() * PageSize; ++i) {
+            if (auto& slot = slot_at(i); slot.occupied) {
+                object(slot)->~T();
+            }
+        }
+    }
+
+    // Builds a T in a free slot, adding a page when there is none
+    template<typename... Args>
+    auto emplace(Args&&... t_args)
+        -> std::pair<Key, T*>
+    {
+        if (m_free == npos) {
+            grow();
+        }
+
+        const auto index = m_free;
+        auto& slot = slot_at(index);
+        auto* created = ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(t_args)...);
+
+        m_free = slot.next_free;
+        slot.occupied = true;
+        ++m_size;
+
+        return {Key{index, slot.generation}, created};
+    }
+
+    // nullptr when the object t_key was given for has been erased
+    auto get(Key t_key) const noexcept
+        -> T*
+    {
+        if (t_key.index >= m_pages.size() * PageSize) {
+            return nullptr;
+        }
+
+        auto& slot = slot_at(t_key.index);
+        return slot.occupied && slot.generation == t_key.generation ? object(slot) : nullptr;
+    }
+
+    auto erase(Key t_key) noexcept
+        -> void
+    {
+        if (auto* found = get(t_key)) {
+            erase(found);
+        }
+    }
+
+    // t_object has to live in this slab
+    auto erase(T* t_object) noexcept
+        -> void
+    {
+        // The storage is the slot's first member, so the object's address is the slot's
+        auto* slot = reinterpret_cast<Slot*>(t_object);
+        t_object->~T();
+
+        slot->occupied = false;
+        ++slot->generation;
+        slot->next_free = m_free;
+        m_free = slot->index;
+        --m_size;
+    }
+
+    auto size() const noexcept
+        -> std::size_t
+    {
+        return m_size;
+    }
+
+    auto capacity() const noexcept
+        -> std::size_t
+    {
+        return m_pages.size() * PageSize;
+    }
+
+private:
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    struct Slot
+    {
+        alignas(T) std::byte storage[sizeof(T)];
+        uint32_t index = 0;
+        uint32_t generation = 0;
+        uint32_t next_free = npos;
+        bool occupied = false;
+    };
+
+    static auto object(const Slot& t_slot) noexcept
+        -> T*
+    {
+        return std::launder(reinterpret_cast<T*>(const_cast<std::byte*>(t_slot.storage)));
+    }
+
+    auto slot_at(std::size_t t_index) const noexcept
+        -> Slot&
+    {
+        return m_pages[t_index / PageSize][t_index % PageSize];
+    }
+
+    // New slots go on the free list lowest index first
+    auto grow()
+        -> void
+    {
+        const auto first = static_cast<uint32_t>(m_pages.size() * PageSize);
+        auto& page = m_pages.emplace_back(std::make_unique<Slot[]>(PageSize));
+
+        for (std::size_t i = PageSize; i-- > 0;) {
+            page[i].index = first + static_cast<uint32_t>(i);
+            page[i].next_free = m_free;
+            m_free = page[i].index;
+        }
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_pages;
+    uint32_t m_free = npos;
+    std::size_t m_size = 0;
+};
+}
@@ -16,7 +16,7 @@ public:
     }
 
     template<typename T>
-    auto get(const std::string& t_name) const
+    auto get(const std::string& t_name) const -> std::shared_ptr<T>
     {
         auto it = m_resources.find(t_name);
         if (it == m_resources.end()) {
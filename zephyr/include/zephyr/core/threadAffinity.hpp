@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+namespace zephyr::core
+{
+// Restricts t_thread to a single CPU; returns false when the CPU does not exist or is not allowed
+auto pinThread(std::thread::native_handle_type t_thread, uint32_t t_cpu) noexcept -> bool;
+
+auto pinCurrentThread(uint32_t t_cpu) noexcept -> bool;
+}  // namespace zephyr::core
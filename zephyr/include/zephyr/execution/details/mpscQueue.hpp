@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+
+namespace zephyr::execution::details
+{
+// Link embedded in whatever is queued; the queue never allocates or owns its nodes
+struct MpscNode
+{
+    std::atomic<MpscNode*> next{nullptr};
+};
+
+// Intrusive multi-producer single-consumer queue (Vyukov). push() is wait-free and may be called
+// from any thread; pop() belongs to a single consumer at a time.
+class MpscQueue
+{
+public:
+    MpscQueue() noexcept : m_head(&m_stub), m_tail(&m_stub) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    ~MpscQueue() = default;
+
+    auto push(MpscNode* t_node) noexcept -> void
+    {
+        t_node->next.store(nullptr, std::memory_order_relaxed);
+        auto* previous = m_head.exchange(t_node, std::memory_order_acq_rel);
+        previous->next.store(t_node, std::memory_order_release);
+    }
+
+    // Returns nullptr when the queue is empty, and also while a producer is between the two steps
+    // of push(); callers that know an element is coming simply retry
+    auto pop() noexcept -> MpscNode*
+    {
+        auto* tail = m_tail;
+        auto* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr) {
+            m_tail = next;
+            return tail;
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        // tail is the last element; put the stub behind it so it can be handed out
+        push(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+private:
+    std::atomic<MpscNode*> m_head;
+    MpscNode* m_tail;
+    MpscNode m_stub;
+};
+}  // namespace zephyr::execution::details
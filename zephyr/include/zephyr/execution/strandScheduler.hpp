@@ -2,20 +2,54 @@
 
 #include <stdexec/execution.hpp>
 
-#include <deque>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <exception>
 #include <memory>
-#include <mutex>
+#include <thread>
 
 #include "stdexec/__detail/__senders_core.hpp"
+#include "zephyr/execution/details/mpscQueue.hpp"
 
 namespace zephyr::execution
 {
+// Hops handed to a base scheduler that have not started running yet, summed over every strand
+// sharing the gauge. Each strand with work waiting has at most one hop queued, so this is how
+// many strands are waiting for a thread: how far the pool behind them has fallen behind.
+class QueueDepth
+{
+public:
+    [[nodiscard]] auto value() const noexcept -> std::size_t
+    {
+        return m_queued.load(std::memory_order_relaxed);
+    }
+
+private:
+    template <stdexec::scheduler BaseScheduler>
+    friend class StrandScheduler;
+
+    std::atomic<std::size_t> m_queued{0};
+};
+
+// How much work one hop through the base scheduler may do before the strand yields the thread
+struct StrandOptions
+{
+    // Tasks run back to back per hop; 0 means no task limit
+    std::size_t maxTasksPerHop{64};
+    // Wall time budget per hop, checked after every task; 0 means no time limit
+    std::chrono::microseconds maxTimePerHop{100};
+    // Counts this strand's queued hops when set
+    std::shared_ptr<QueueDepth> queueDepth;
+};
+
 template <stdexec::scheduler BaseScheduler>
 class StrandScheduler
 {
 public:
-    explicit StrandScheduler(BaseScheduler t_base) : m_state(std::make_shared<StrandState>(std::move(t_base))) {}
+    explicit StrandScheduler(BaseScheduler t_base, StrandOptions t_options = {})
+        : m_state(std::make_shared<StrandState>(std::move(t_base), t_options))
+    {}
 
     friend auto tag_invoke(stdexec::schedule_t /*unused*/, const StrandScheduler& t_self)
     {
@@ -33,87 +67,96 @@ public:
     }
 
 private:
-    struct TaskBase
-    {
-        virtual ~TaskBase() = default;
-        virtual void execute() = 0;
-    };
-
-    template <typename Receiver>
-    struct TaskImpl : TaskBase
+    // Queue node; the operation state of every scheduled task is its own node, so scheduling onto
+    // the strand never allocates
+    struct TaskBase : details::MpscNode
     {
-        Receiver receiver;
-
-        explicit TaskImpl(Receiver t_receiver) noexcept(std::is_nothrow_move_constructible_v<Receiver>)
-            : receiver(std::move(t_receiver))
-        {}
+        using ExecuteFn = void (*)(TaskBase*) noexcept;
 
-        auto execute() -> void override
-        {
-            try {
-                stdexec::set_value(std::move(receiver));
-            } catch (...) {
-                stdexec::set_error(std::move(receiver), std::current_exception());
-            }
-        }
+        ExecuteFn execute{nullptr};
     };
 
     struct StrandState : std::enable_shared_from_this<StrandState>
     {
         BaseScheduler base;
-        std::mutex mutex;
-        std::deque<std::unique_ptr<TaskBase>> queue;
-        bool running{false};
-
-        explicit StrandState(BaseScheduler t_scheduler) : base(std::move(t_scheduler)) {}
+        StrandOptions options;
+        details::MpscQueue queue;
+        // Tasks pushed but not yet executed; the producer that moves it off zero starts the drain
+        std::atomic<std::size_t> pending{0};
+
+        StrandState(BaseScheduler t_scheduler, StrandOptions t_options)
+            : base(std::move(t_scheduler)),
+              options(t_options)
+        {}
 
+        // Runs queued tasks until the strand is empty or the hop budget is spent; in the latter case
+        // the rest is handed back to the base scheduler so other work on it gets a turn
         void executeNext()
         {
-            std::unique_ptr<TaskBase> task;
+            const auto deadline = std::chrono::steady_clock::now() + options.maxTimePerHop;
 
-            {
-                std::lock_guard lock(mutex);
-                if (queue.empty()) {
-                    running = false;
+            for (std::size_t executed = 1;; ++executed) {
+                auto* task = popTask();
+                task->execute(task);
+
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
                     return;
                 }
 
-                task = std::move(queue.front());
-                queue.pop_front();
+                if (budgetSpent(executed, deadline)) {
+                    break;
+                }
             }
 
-            task->execute();
+            scheduleDrain();
+        }
 
-            auto self = this->shared_from_this();
-            auto continuation
-                = stdexec::schedule(base) | stdexec::then([self = std::move(self)]() { self->executeNext(); });
+        void enqueueTask(TaskBase* t_task) noexcept
+        {
+            queue.push(t_task);
 
-            stdexec::start_detached(std::move(continuation));
+            if (pending.fetch_add(1, std::memory_order_acq_rel) == 0) {
+                scheduleDrain();
+            }
         }
 
-        template <typename Receiver>
-        void enqueueTask(Receiver t_receiver)
+    private:
+        [[nodiscard]] auto budgetSpent(std::size_t t_executed,
+                                       std::chrono::steady_clock::time_point t_deadline) const noexcept -> bool
         {
-            bool shouldStart = false;
-            auto task = std::make_unique<TaskImpl<Receiver>>(std::move(t_receiver));
+            if (options.maxTasksPerHop != 0 && t_executed >= options.maxTasksPerHop) {
+                return true;
+            }
 
-            {
-                std::lock_guard lock(mutex);
-                queue.push_back(std::move(task));
+            return options.maxTimePerHop.count() != 0 && std::chrono::steady_clock::now() >= t_deadline;
+        }
 
-                if (!running) {
-                    running = true;
-                    shouldStart = true;
-                }
+        // pending > 0 guarantees an element, but its producer may still be linking it in
+        auto popTask() noexcept -> TaskBase*
+        {
+            details::MpscNode* node = nullptr;
+            while ((node = queue.pop()) == nullptr) {
+                std::this_thread::yield();
             }
 
-            if (shouldStart) {
-                auto self = this->shared_from_this();
-                auto starter
-                    = stdexec::schedule(base) | stdexec::then([self = std::move(self)]() { self->executeNext(); });
+            return static_cast<TaskBase*>(node);
+        }
 
-                stdexec::start_detached(std::move(starter));
+        void scheduleDrain()
+        {
+            if (options.queueDepth) {
+                options.queueDepth->m_queued.fetch_add(1, std::memory_order_relaxed);
             }
+
+            auto self = this->shared_from_this();
+            auto continuation = stdexec::schedule(base) | stdexec::then([self = std::move(self)]() {
+                if (self->options.queueDepth) {
+                    self->options.queueDepth->m_queued.fetch_sub(1, std::memory_order_relaxed);
+                }
+                self->executeNext();
+            });
+
+            stdexec::start_detached(std::move(continuation));
         }
     };
 
@@ -126,14 +169,32 @@ private:
         std::shared_ptr<StrandState> state;
 
         template <typename Receiver>
-        struct OperationState
+        struct OperationState : TaskBase
         {
             std::shared_ptr<StrandState> state;
             Receiver receiver;
 
+            OperationState(std::shared_ptr<StrandState> t_state, Receiver t_receiver)
+                : state(std::move(t_state)),
+                  receiver(std::move(t_receiver))
+            {
+                this->execute = &OperationState::run;
+            }
+
+            static auto run(TaskBase* t_task) noexcept -> void
+            {
+                auto& self = *static_cast<OperationState*>(t_task);
+
+                try {
+                    stdexec::set_value(std::move(self.receiver));
+                } catch (...) {
+                    stdexec::set_error(std::move(self.receiver), std::current_exception());
+                }
+            }
+
             friend void tag_invoke(stdexec::start_t /*unused*/, OperationState& t_operation) noexcept
             {
-                t_operation.state->enqueueTask(std::move(t_operation.receiver));
+                t_operation.state->enqueueTask(&t_operation);
             }
         };
 
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace zephyr::http::details
+{
+enum class ChunkedStatus
+{
+    incomplete,
+    complete,
+    error
+};
+
+struct ChunkedResult
+{
+    ChunkedStatus status = ChunkedStatus::incomplete;
+    // Input bytes that belonged to the body; on complete, whatever follows is the next message
+    std::size_t consumed = 0;
+};
+
+// Incremental decoder for a chunked message body (RFC 9112, 7.1). Input may be split anywhere:
+// a partial size or trailer line is kept until the rest arrives, and chunk data is appended to
+// the output as soon as it is seen, so the caller never has to keep the encoded bytes around.
+class ChunkedDecoder
+{
+public:
+    explicit ChunkedDecoder(std::size_t t_max_body_bytes = std::numeric_limits<std::size_t>::max(),
+                            std::size_t t_max_trailer_bytes = 8 * 1024) noexcept
+        : m_max_body_bytes(t_max_body_bytes), m_max_trailer_bytes(t_max_trailer_bytes) {}
+
+    // Decodes what it can of t_input, appending chunk data to t_out
+    auto decode(std::string_view t_input, std::string& t_out)
+        -> ChunkedResult;
+
+    // Body bytes decoded since the last reset()
+    auto decoded() const noexcept
+        -> std::size_t
+    {
+        return m_decoded;
+    }
+
+    auto reset() noexcept
+        -> void;
+
+private:
+    enum class State
+    {
+        size,
+        data,
+        data_end,
+        trailers,
+        complete,
+        error
+    };
+
+    // Handles one line without its line ending; false when it is malformed
+    auto end_line(std::string_view t_line)
+        -> bool;
+
+    std::size_t m_max_body_bytes;
+    std::size_t m_max_trailer_bytes;
+    State m_state = State::size;
+    std::size_t m_remaining = 0;
+    std::size_t m_decoded = 0;
+    std::size_t m_trailer_bytes = 0;
+    // Start of a line whose end has not arrived yet
+    std::string m_line;
+};
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace zephyr::http::details
+{
+enum class ScannerKind
+{
+    scalar,
+    sse2,
+    avx2
+};
+
+struct ScanResult
+{
+    // Offsets written to the output
+    std::size_t count = 0;
+    // Every delimiter before this offset has been reported
+    std::size_t scanned = 0;
+};
+
+// Writes the offset of every t_a or t_b in [t_from, t_size) of t_data to t_out, in order, and stops
+// early once t_out is full. Offsets are absolute, so t_size must fit in 32 bits.
+using IndexAnyFn = ScanResult (*)(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                                  std::span<uint32_t> t_out) noexcept;
+
+// nullptr when this CPU cannot run the given kind
+auto scanner_for(ScannerKind t_kind) noexcept
+    -> IndexAnyFn;
+
+// Widest kind the CPU supports, detected once
+auto best_scanner() noexcept
+    -> ScannerKind;
+
+// index_any() on the best scanner for this CPU
+auto index_any(std::string_view t_data, std::size_t t_from, char t_a, char t_b, std::span<uint32_t> t_out) noexcept
+    -> ScanResult;
+
+// Offset of the first t_a or t_b at or after t_from, or npos
+inline auto find_any(std::string_view t_data, std::size_t t_from, char t_a, char t_b) noexcept
+    -> std::size_t
+{
+    uint32_t hit = 0;
+    return index_any(t_data, t_from, t_a, t_b, {&hit, 1}).count != 0 ? hit : std::string_view::npos;
+}
+}
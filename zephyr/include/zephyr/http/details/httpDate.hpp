@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <string_view>
+
+namespace zephyr::http::details
+{
+// "Sun, 06 Nov 1994 08:49:37 GMT"
+inline constexpr std::size_t http_date_size = 29;
+
+// IMF-fixdate, written without strftime so the locale cannot change it
+auto format_http_date(std::time_t t_time, char (&t_out)[http_date_size]) noexcept
+    -> void;
+
+// The current date, formatted at most once per second per thread. The view stays valid on the
+// calling thread until the next call.
+auto cached_http_date() noexcept
+    -> std::string_view;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sys/types.h>
+
+namespace zephyr::http::details
+{
+// An open regular file and what its validators were when it was opened. The descriptor is closed
+// when the last holder lets go, so a response being written keeps it past eviction.
+struct OpenFile
+{
+    int fd = -1;
+    uint64_t size = 0;
+    std::timespec modified{};
+    dev_t device = 0;
+    ino_t inode = 0;
+    // Strong validator built from size and modification time, quotes included
+    std::string etag;
+    // IMF-fixdate of the modification time
+    std::string last_modified;
+
+    OpenFile() = default;
+    OpenFile(const OpenFile&) = delete;
+    OpenFile& operator=(const OpenFile&) = delete;
+    ~OpenFile();
+};
+
+// Bounded LRU of open descriptors and their stat results, shared by every connection. A hit
+// younger than the revalidation interval costs one hash lookup; an older one is checked with a
+// stat() and reopened only when the file changed.
+class OpenFileCache
+{
+public:
+    OpenFileCache(std::size_t t_capacity, std::chrono::nanoseconds t_revalidate_after)
+        : m_capacity(t_capacity), m_revalidate_after(t_revalidate_after) {}
+
+    // nullptr when t_path does not name a regular file that can be read
+    auto open(const std::string& t_path)
+        -> std::shared_ptr<const OpenFile>;
+
+    auto size() const
+        -> std::size_t;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        std::shared_ptr<const OpenFile> file;
+        Clock::time_point checked;
+        std::list<std::string>::iterator position;
+    };
+
+    auto insert(const std::string& t_path, std::shared_ptr<const OpenFile> t_file, Clock::time_point t_now)
+        -> void;
+
+    auto erase(const std::string& t_path)
+        -> void;
+
+    std::size_t m_capacity;
+    std::chrono::nanoseconds m_revalidate_after;
+
+    mutable std::mutex m_mutex;
+    // Most recently used first
+    std::list<std::string> m_order;
+    std::unordered_map<std::string, Entry> m_entries;
+};
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace zephyr::http::details
+{
+struct RouteMatch
+{
+    static constexpr std::size_t max_params = 8;
+
+    std::size_t route = 0;
+    // Values of the pattern's :params in pattern order; they point into the looked up path
+    std::array<std::string_view, max_params> param_storage{};
+    std::size_t param_count = 0;
+
+    auto params() const noexcept
+        -> std::span<const std::string_view>
+    {
+        return {param_storage.data(), param_count};
+    }
+};
+
+// Compressed prefix tree over route patterns. Static text is shared between patterns, ":name"
+// matches one non-empty path segment and a trailing "*" matches the rest of the path. Lookup walks
+// the path once, preferring static text over :params over "*", and does not allocate.
+class RadixTree
+{
+public:
+    // t_method "*" accepts every method. The first route registered for a method and pattern wins.
+    // Throws std::invalid_argument for a "*" that is not at the end or too many :params.
+    auto insert(std::string_view t_method, std::string_view t_pattern, std::size_t t_route)
+        -> void;
+
+    auto find(std::string_view t_method, std::string_view t_path, RouteMatch& t_match) const noexcept
+        -> bool;
+
+private:
+    struct Node
+    {
+        std::string prefix;
+        std::vector<std::unique_ptr<Node>> children;
+        std::unique_ptr<Node> param_child;
+        std::unique_ptr<Node> wildcard_child;
+        // Routes ending at this node, by method
+        std::vector<std::pair<std::string, std::size_t>> routes;
+
+        auto route_for(std::string_view t_method) const noexcept
+            -> const std::size_t*;
+    };
+
+    static auto insert(Node& t_node, std::string_view t_method, std::string_view t_pattern, std::size_t t_route,
+                       std::size_t t_params) -> void;
+
+    static auto find(const Node& t_node, std::string_view t_method, std::string_view t_path,
+                     RouteMatch& t_match) noexcept -> bool;
+
+    Node m_root;
+};
+}
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace zephyr::http::details
+{
+// String literal usable as a template argument
+template<std::size_t N>
+struct FixedString
+{
+    char data[N]{};
+
+    consteval FixedString(const char (&t_text)[N])
+    {
+        std::copy_n(t_text, N, data);
+    }
+
+    constexpr auto view() const noexcept
+        -> std::string_view
+    {
+        return {data, N - 1};
+    }
+};
+
+// string_view::find compares a pointer into the template argument object against null, which GCC 12
+// does not accept in constant expressions; the pattern helpers use this instead
+constexpr auto find_char(std::string_view t_text, char t_char, std::size_t t_from = 0) noexcept
+    -> std::size_t
+{
+    for (auto i = t_from; i < t_text.size(); ++i) {
+        if (t_text[i] == t_char) {
+            return i;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+struct RouteKey
+{
+    std::string_view method;
+    std::string_view pattern;
+};
+
+// Same syntax as the runtime router: ":name" is one non-empty segment, a trailing "*" is the rest
+constexpr auto is_static_pattern(std::string_view t_pattern) noexcept
+    -> bool
+{
+    return find_char(t_pattern, ':') == std::string_view::npos && find_char(t_pattern, '*') == std::string_view::npos;
+}
+
+constexpr auto param_count(std::string_view t_pattern) noexcept
+    -> std::size_t
+{
+    return static_cast<std::size_t>(std::count(t_pattern.begin(), t_pattern.end(), ':'));
+}
+
+constexpr auto is_valid_pattern(std::string_view t_pattern) noexcept
+    -> bool
+{
+    if (t_pattern.empty() || t_pattern.front() != '/') {
+        return false;
+    }
+
+    const auto star = find_char(t_pattern, '*');
+    if (star != std::string_view::npos && star != t_pattern.size() - 1) {
+        return false;
+    }
+
+    for (std::size_t pos = find_char(t_pattern, ':'); pos != std::string_view::npos;
+         pos = find_char(t_pattern, ':', pos + 1)) {
+        if (pos + 1 == t_pattern.size() || t_pattern[pos + 1] == '/' || t_pattern[pos + 1] == '*') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<std::size_t MaxParams>
+constexpr auto param_names(std::string_view t_pattern) noexcept
+    -> std::array<std::string_view, MaxParams>
+{
+    std::array<std::string_view, MaxParams> names{};
+    std::size_t count = 0;
+
+    for (std::size_t pos = find_char(t_pattern, ':'); pos != std::string_view::npos && count < MaxParams;
+         pos = find_char(t_pattern, ':', pos)) {
+        const auto end = std::min(find_char(t_pattern, '/', pos), t_pattern.size());
+        names[count++] = t_pattern.substr(pos + 1, end - pos - 1);
+        pos = end;
+    }
+
+    return names;
+}
+
+// Matches a parameterised pattern against a path, writing the :param values in pattern order.
+// The pattern is a constant at every call site, so the compiler unrolls the literal parts.
+constexpr auto match_pattern(std::string_view t_pattern, std::string_view t_path,
+                             std::span<std::string_view> t_params) noexcept -> bool
+{
+    std::size_t p = 0;
+    std::size_t s = 0;
+    std::size_t count = 0;
+
+    while (p < t_pattern.size()) {
+        if (t_pattern[p] == '*') {
+            return true;
+        }
+
+        if (t_pattern[p] == ':') {
+            const auto end = std::min(find_char(t_path, '/', s), t_path.size());
+            if (end == s) {
+                return false;
+            }
+
+            t_params[count++] = t_path.substr(s, end - s);
+            s = end;
+            p = std::min(find_char(t_pattern, '/', p), t_pattern.size());
+            continue;
+        }
+
+        if (s == t_path.size() || t_pattern[p] != t_path[s]) {
+            return false;
+        }
+
+        ++p;
+        ++s;
+    }
+
+    return s == t_path.size();
+}
+
+// FNV-1a over "<method> <path>", finished with a murmur mix so both halves are usable
+constexpr auto route_hash(std::string_view t_method, std::string_view t_path, uint64_t t_seed) noexcept
+    -> uint64_t
+{
+    uint64_t hash = 0xcbf29ce484222325ULL ^ t_seed;
+    const auto step = [&hash](char t_char) {
+        hash ^= static_cast<uint8_t>(t_char);
+        hash *= 0x100000001b3ULL;
+    };
+
+    for (const char c : t_method) {
+        step(c);
+    }
+    step(' ');
+    for (const char c : t_path) {
+        step(c);
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template<std::size_t N>
+constexpr auto has_duplicate_routes(const std::array<RouteKey, N>& t_keys) noexcept
+    -> bool
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = i + 1; j < N; ++j) {
+            if (t_keys[i].method == t_keys[j].method && t_keys[i].pattern == t_keys[j].pattern) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Hash-and-displace perfect hash over the static routes of a table. The high half of the hash picks
+// a bucket, the bucket's displacement is XORed into the low half to pick the slot; every static
+// route owns exactly one slot, so a lookup costs one hash, one load and one comparison.
+template<std::size_t N>
+struct PerfectHash
+{
+    static constexpr std::size_t bucket_count = std::bit_ceil(std::max<std::size_t>(N, 1));
+    static constexpr std::size_t slot_count = bucket_count * 2;
+    static constexpr uint16_t empty = UINT16_MAX;
+
+    uint64_t seed = 0;
+    std::array<uint16_t, bucket_count> displacement{};
+    std::array<uint16_t, slot_count> slots{};
+
+    constexpr auto find(std::string_view t_method, std::string_view t_path) const noexcept
+        -> std::size_t
+    {
+        const auto hash = route_hash(t_method, t_path, seed);
+        const auto bucket = (hash >> 32) & (bucket_count - 1);
+        return slots[(hash ^ displacement[bucket]) & (slot_count - 1)];
+    }
+};
+
+template<std::size_t N>
+consteval auto build_perfect_hash(const std::array<RouteKey, N>& t_keys)
+    -> PerfectHash<N>
+{
+    using Table = PerfectHash<N>;
+
+    for (uint64_t seed = 0; seed < 256; ++seed) {
+        Table table{.seed = seed};
+        table.slots.fill(Table::empty);
+
+        std::array<uint64_t, N> hashes{};
+        std::array<std::size_t, Table::bucket_count> sizes{};
+        for (std::size_t i = 0; i < N; ++i) {
+            if (is_static_pattern(t_keys[i].pattern) && t_keys[i].method != "*") {
+                hashes[i] = route_hash(t_keys[i].method, t_keys[i].pattern, seed);
+                ++sizes[(hashes[i] >> 32) & (Table::bucket_count - 1)];
+            }
+        }
+
+        // Fullest buckets first, while most slots are still free
+        std::array<std::size_t, Table::bucket_count> order{};
+        for (std::size_t b = 0; b < order.size(); ++b) {
+            order[b] = b;
+        }
+        std::sort(order.begin(), order.end(), [&sizes](std::size_t t_a, std::size_t t_b) {
+            return sizes[t_a] > sizes[t_b];
+        });
+
+        bool placed_all = true;
+        for (const auto bucket : order) {
+            if (sizes[bucket] == 0) {
+                break;
+            }
+
+            bool placed = false;
+            for (uint16_t d = 0; d < Table::slot_count && !placed; ++d) {
+                auto slots = table.slots;
+                placed = true;
+
+                for (std::size_t i = 0; i < N && placed; ++i) {
+                    if (!is_static_pattern(t_keys[i].pattern) || t_keys[i].method == "*"
+                        || ((hashes[i] >> 32) & (Table::bucket_count - 1)) != bucket) {
+                        continue;
+                    }
+
+                    auto& slot = slots[(hashes[i] ^ d) & (Table::slot_count - 1)];
+                    placed = slot == Table::empty;
+                    slot = static_cast<uint16_t>(i);
+                }
+
+                if (placed) {
+                    table.displacement[bucket] = d;
+                    table.slots = slots;
+                }
+            }
+
+            if (!placed) {
+                placed_all = false;
+                break;
+            }
+        }
+
+        if (placed_all) {
+            return table;
+        }
+    }
+
+    throw std::logic_error("no perfect hash for the route table");
+}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "zephyr/common/callbackSender.hpp"
+#include "zephyr/common/rendezvous.hpp"
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+// One piece of a streamed body; nullopt marks its end
+using BodyChunk = std::optional<std::string>;
+using BodyChunkSender = common::ResultSender<BodyChunk>;
+using BodyChannel = common::Rendezvous<BodyChunk>;
+
+// Request body of a streaming route, handed over one received piece at a time. The connection
+// reads no further until the handler has taken the current piece, so however large the upload,
+// only about one read's worth of it is held in memory.
+class HttpBodyReader
+{
+public:
+    explicit HttpBodyReader(std::shared_ptr<BodyChannel> t_channel) : m_channel(std::move(t_channel)) {}
+
+    // Completes with the next piece, with nullopt once the whole body has been read, or with an
+    // error when the connection went away first. Only one next() may be outstanding at a time.
+    auto next() const
+        -> BodyChunkSender
+    {
+        return BodyChunkSender{common::from_callback<BodyChunk>([channel = m_channel](auto t_done) {
+            channel->pull(std::move(t_done));
+        })};
+    }
+
+private:
+    std::shared_ptr<BodyChannel> m_channel;
+};
+
+// Response body produced on demand. next() is called again only once the previous piece has been
+// written to the socket, so a slow client slows the producer down instead of filling memory.
+struct HttpBodyProducer
+{
+    std::function<BodyChunkSender()> next;
+};
+
+// A response whose body comes from t_next; without a Content-Length header it is sent chunked
+inline auto streamed_response(std::function<BodyChunkSender()> t_next)
+    -> HttpResponse
+{
+    HttpResponse response;
+    response.body_producer = std::make_shared<HttpBodyProducer>(HttpBodyProducer{std::move(t_next)});
+    return response;
+}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "zephyr/common/rendezvous.hpp"
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/http/httpBody.hpp"
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/http/httpRequestStream.hpp"
+#include "zephyr/http/httpRouter.hpp"
+#include "zephyr/tcp/tcpProtocol.hpp"
+
+namespace zephyr::http
+{
+// Request handling shared by the HTTP pipelines. Frames the received bytes, runs each request
+// through the handler in arrival order and turns the responses into the session's output.
+//
+// A request for a streaming route is handed to its handler as soon as its headers are in; the
+// output for every read that carries part of its body completes only once the handler has taken
+// that part, so the session does not receive more until then. The response is written once the
+// body has been received. A response with a body producer is written as the producer yields, and
+// the responses pipelined behind it wait until its body is out.
+class HttpConnection
+{
+public:
+    using Handler = std::function<common::ResultSender<HttpResponse>(HttpRequest)>;
+
+    explicit HttpConnection(const HttpRouter& t_router);
+
+    HttpConnection(HttpConnection&&) noexcept = default;
+    HttpConnection& operator=(HttpConnection&&) noexcept = default;
+
+    // A handler still reading a body learns that it will not get the rest
+    ~HttpConnection();
+
+    // t_handler is called with each request framed from t_data. For streamed requests that happens
+    // before this returns, for the others once the responses before theirs are ready.
+    auto operator()(std::string_view t_data, const Handler& t_handler)
+        -> tcp::TcpProtocol::ResultSenderType;
+
+private:
+    // The request whose body is being received
+    struct StreamedRequest
+    {
+        std::shared_ptr<BodyChannel> body;
+        std::shared_ptr<common::Rendezvous<HttpResponse>> response;
+        std::string_view connection;
+        bool http10 = false;
+    };
+
+    auto start_streamed(HttpRequest t_request, const Handler& t_handler)
+        -> void;
+
+    HttpRequestStream m_stream;
+    std::vector<HttpStreamItem> m_items;
+    StreamedRequest m_streamed;
+};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string_view>
+
+// Header names used by the library itself, interned once instead of spelled out at each use.
+// HttpHeaders compares transparently, so they can be looked up without building a std::string.
+namespace zephyr::http::headers
+{
+inline constexpr std::string_view accept_ranges = "Accept-Ranges";
+inline constexpr std::string_view age = "Age";
+inline constexpr std::string_view authorization = "Authorization";
+inline constexpr std::string_view cache_control = "Cache-Control";
+inline constexpr std::string_view connection = "Connection";
+inline constexpr std::string_view content_length = "Content-Length";
+inline constexpr std::string_view content_range = "Content-Range";
+inline constexpr std::string_view content_type = "Content-Type";
+inline constexpr std::string_view date = "Date";
+inline constexpr std::string_view etag = "ETag";
+inline constexpr std::string_view host = "Host";
+inline constexpr std::string_view if_none_match = "If-None-Match";
+inline constexpr std::string_view keep_alive = "Keep-Alive";
+inline constexpr std::string_view last_modified = "Last-Modified";
+inline constexpr std::string_view range = "Range";
+inline constexpr std::string_view server = "Server";
+inline constexpr std::string_view set_cookie = "Set-Cookie";
+inline constexpr std::string_view transfer_encoding = "Transfer-Encoding";
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "zephyr/io/fileRegion.hpp"
+
+namespace zephyr::http
+{
+// Transparent comparison lets lookups use the interned names in httpHeaders.hpp without allocating
+using HttpHeaders = std::map<std::string, std::string, std::less<>>;
+
+// Streamed bodies, see httpBody.hpp
+class HttpBodyReader;
+struct HttpBodyProducer;
+
+struct HttpRequest
+{
+    std::string method;
+    std::string path;
+    std::string version;
+    HttpHeaders headers;
+    std::map<std::string, std::string> path_params;
+    std::string body;
+    // Set instead of body on routes that stream their request body
+    std::shared_ptr<HttpBodyReader> body_stream;
+};
+
+// A response rendered once and written any number of times, as the response cache keeps it
+struct PrerenderedResponse
+{
+    int status_code = 200;
+    std::string status_text = "OK";
+    // Status line and header lines, without the blank line that ends them
+    std::shared_ptr<const std::string> head;
+    std::shared_ptr<const std::string> body;
+};
+
+struct HttpResponse
+{
+    int status_code = 200;
+    std::string status_text = "OK";
+    HttpHeaders headers;
+    std::string body;
+    // When set, the body is pulled from it after the headers are sent and body is ignored
+    std::shared_ptr<HttpBodyProducer> body_producer;
+    // When set, the body is this part of a file, spliced to the socket; body is ignored
+    std::optional<io::FileRegion> file_body;
+    // When set, its head and body are written as they are, with headers added to the head;
+    // status_code, status_text and body are ignored
+    std::shared_ptr<const PrerenderedResponse> prerendered;
+
+    static auto ok(std::string t_body_text) -> HttpResponse;
+
+    static auto json(std::string t_json_text) -> HttpResponse;
+
+    static auto not_found() -> HttpResponse;
+};
+}
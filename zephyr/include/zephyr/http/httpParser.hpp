@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "zephyr/http/details/chunkedDecoder.hpp"
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/http/httpRequestView.hpp"
+
+namespace zephyr::http
+{
+enum class HttpParseStatus
+{
+    incomplete,
+    complete,
+    error
+};
+
+struct HttpParserLimits
+{
+    // Request line plus headers, including the blank line that ends them
+    std::size_t max_header_bytes = 8 * 1024;
+    std::size_t max_body_bytes = 1024 * 1024;
+};
+
+// Resumable HTTP/1.1 request parser. The caller keeps appending received bytes to one buffer and
+// feeds all of it after every read; scanning resumes where the previous call stopped, so every
+// byte is looked at once. Positions are kept as offsets, which lets the buffer reallocate between
+// calls. Nothing is copied: request() points into the buffer passed to the last feed(), except for
+// a chunked body, which is decoded into storage owned by the parser.
+class HttpParser
+{
+public:
+    explicit HttpParser(HttpParserLimits t_limits = {})
+        : m_limits(t_limits), m_chunked_decoder(t_limits.max_body_bytes, t_limits.max_header_bytes) {}
+
+    auto feed(std::string_view t_buffer)
+        -> HttpParseStatus;
+
+    // Stops once the headers are parsed and publishes the request with an empty body, which lets the
+    // caller read the body itself from body_offset() on. feed() picks up from here when it is not.
+    // The body limit is not applied to a message read this way.
+    auto feed_head(std::string_view t_buffer)
+        -> HttpParseStatus;
+
+    // Valid after feed() returned complete, for as long as the buffer given to it and until reset()
+    auto request() const noexcept
+        -> const HttpRequestView&
+    {
+        return m_request;
+    }
+
+    // Bytes of the buffer taken by the complete request; whatever follows belongs to the next one
+    auto consumed() const noexcept
+        -> std::size_t
+    {
+        return m_message_end;
+    }
+
+    // Where the body starts in the buffer, once the headers are parsed
+    auto body_offset() const noexcept
+        -> std::size_t
+    {
+        return m_body_offset;
+    }
+
+    auto content_length() const noexcept
+        -> std::size_t
+    {
+        return m_content_length;
+    }
+
+    auto is_chunked() const noexcept
+        -> bool
+    {
+        return m_chunked;
+    }
+
+    // Prepares for the next request, which starts at offset 0 of the next buffer fed
+    auto reset() noexcept
+        -> void;
+
+    // One-shot convenience: parses a whole request and copies it out
+    static auto parse(std::string_view t_raw)
+        -> std::optional<HttpRequest>;
+
+private:
+    enum class State
+    {
+        request_line,
+        headers,
+        body,
+        chunked_body,
+        complete,
+        error
+    };
+
+    struct Token
+    {
+        std::size_t offset = 0;
+        std::size_t length = 0;
+
+        auto in(std::string_view t_buffer) const noexcept -> std::string_view
+        {
+            return t_buffer.substr(offset, length);
+        }
+    };
+
+    // Handles the line ending at t_newline; false when it is malformed
+    auto end_line(std::string_view t_buffer, std::size_t t_newline)
+        -> bool;
+
+    auto parse_request_line(std::string_view t_line, std::size_t t_offset)
+        -> bool;
+
+    // t_colon is the buffer offset of the first colon on the line, npos if there is none
+    auto parse_header_line(std::string_view t_line, std::size_t t_offset, std::size_t t_colon)
+        -> bool;
+
+    // Runs the request line and header states; complete once the blank line after the headers is seen
+    auto feed_headers(std::string_view t_buffer)
+        -> HttpParseStatus;
+
+    auto fail()
+        -> HttpParseStatus;
+
+    auto publish(std::string_view t_buffer, std::string_view t_body)
+        -> void;
+
+    HttpParserLimits m_limits;
+    State m_state = State::request_line;
+    std::size_t m_position = 0;
+    std::size_t m_scanned = 0;
+    std::size_t m_colon = std::string_view::npos;
+    std::size_t m_body_offset = 0;
+    std::size_t m_content_length = 0;
+    std::size_t m_message_end = 0;
+    bool m_has_content_length = false;
+    bool m_chunked = false;
+    details::ChunkedDecoder m_chunked_decoder;
+    std::string m_chunked_body;
+
+    Token m_method;
+    Token m_path;
+    Token m_version;
+    std::array<std::array<Token, 2>, HttpRequestView::max_headers> m_headers{};
+    std::size_t m_header_count = 0;
+
+    HttpRequestView m_request;
+};
+}
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "zephyr/context/context.hpp"
+#include "zephyr/http/httpConnection.hpp"
 #include "zephyr/http/httpRouter.hpp"
 #include "zephyr/tcp/tcpProtocol.hpp"
 
@@ -13,11 +14,11 @@ class HttpPipeline
 public:
     explicit HttpPipeline(const HttpRouter& t_router);
 
-    auto operator()(std::string t_data, std::shared_ptr<context::Context>)
+    auto operator()(tcp::TcpProtocol::InputType t_data, std::shared_ptr<context::Context>)
         -> tcp::TcpProtocol::ResultSenderType;
 
 private:
     const HttpRouter& m_router;
-    std::string m_receive_buffer;
+    HttpConnection m_connection;
 };
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "zephyr/http/httpPipeline.hpp"
 #include "zephyr/http/httpPipelineWithMiddleware.hpp"
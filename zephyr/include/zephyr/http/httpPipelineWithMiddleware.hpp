@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdexec/execution.hpp>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/context/context.hpp"
+#include "zephyr/http/httpConnection.hpp"
+#include "zephyr/http/httpRouter.hpp"
+#include "zephyr/http/middlewares/httpMiddlewaresConcept.hpp"
+#include "zephyr/tcp/tcpProtocol.hpp"
+
+namespace zephyr::http
+{
+template<typename... Middlewares>
+class HttpPipelineWithMiddleware
+{
+public:
+    HttpPipelineWithMiddleware(const HttpRouter& t_router, Middlewares... t_midllewares)
+        : m_router(t_router), m_connection(t_router), m_middlewares(std::move(t_midllewares)...) {}
+
+    auto operator()(tcp::TcpProtocol::InputType data, std::shared_ptr<context::Context>)
+        -> tcp::TcpProtocol::ResultSenderType
+    {
+        return m_connection(data.view(), [this](HttpRequest t_request) {
+            return handle(std::move(t_request));
+        });
+    }
+
+private:
+    auto handle(HttpRequest t_request)
+        -> common::ResultSender<HttpResponse>
+    {
+        return common::ResultSender<HttpResponse>{
+            run<0>(std::move(t_request))
+                | stdexec::upon_error([](std::exception_ptr e) -> HttpResponse {
+                    try { std::rethrow_exception(e); }
+                    catch (const std::exception& ex) {
+                        std::cout << "[HTTP] Middleware error: " << ex.what() << "\n";
+                        HttpResponse error_resp{};
+                        error_resp.status_code = 401;
+                        error_resp.status_text = "Unauthorized";
+                        error_resp.body = ex.what();
+                        return error_resp;
+                    }
+                })
+        };
+    }
+
+    // Middlewares run in the order they were added, then the router. One that passes the request
+    // on is followed by the next stage; a wrapping one is given the remaining stages as next.
+    template<std::size_t I>
+    auto run(HttpRequest t_request)
+        -> common::ResultSender<HttpResponse>
+    {
+        auto request = stdexec::just(std::move(t_request));
+
+        if constexpr (I == sizeof...(Middlewares)) {
+            return common::ResultSender<HttpResponse>{
+                std::move(request) | stdexec::let_value([this](HttpRequest req) {
+                    return m_router.route(req);
+                })
+            };
+        } else if constexpr (HttpWrappingMiddlewareConcept<std::tuple_element_t<I, std::tuple<Middlewares...>>>) {
+            return common::ResultSender<HttpResponse>{
+                std::move(request) | stdexec::let_value([this](HttpRequest& req) {
+                    return std::get<I>(m_middlewares)(std::move(req), HttpNext{[this](HttpRequest t_next) {
+                        return run<I + 1>(std::move(t_next));
+                    }});
+                })
+            };
+        } else {
+            return common::ResultSender<HttpResponse>{
+                std::move(request)
+                    | stdexec::let_value(std::get<I>(m_middlewares))
+                    | stdexec::let_value([this](HttpRequest& req) {
+                        return run<I + 1>(std::move(req));
+                    })
+            };
+        }
+    }
+
+    const HttpRouter& m_router;
+    HttpConnection m_connection;
+    std::tuple<Middlewares...> m_middlewares;
+};
+}
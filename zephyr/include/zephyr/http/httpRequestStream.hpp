@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "zephyr/http/details/chunkedDecoder.hpp"
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/http/httpParser.hpp"
+#include "zephyr/http/httpRequestView.hpp"
+
+namespace zephyr::http
+{
+struct FramedRequest
+{
+    HttpRequest request;
+    // Whether the connection stays open after the response to this request
+    bool keep_alive = true;
+    // The body is not in request.body; it follows as BodyPiece items
+    bool streams_body = false;
+};
+
+// Part of a streamed request body, in arrival order
+struct BodyPiece
+{
+    std::string data;
+    // The body ends with this piece; the next item belongs to the next request
+    bool last = false;
+};
+
+using HttpStreamItem = std::variant<FramedRequest, BodyPiece>;
+
+// Value for the Connection header of the response to t_request, empty when the protocol default
+// already says what happens to the connection
+auto connection_header(const FramedRequest& t_request) noexcept
+    -> std::string_view;
+
+enum class HttpStreamStatus
+{
+    // Every complete request was taken; the connection stays open
+    open,
+    // A request asked for the connection to end; bytes after it are ignored
+    closing,
+    // The stream is malformed and cannot be framed any further
+    error
+};
+
+// Frames a connection's byte stream into requests. One read may carry several pipelined requests,
+// and a request may span several reads. Requests are parsed straight out of the received chunk,
+// and only the unfinished tail is kept between calls.
+//
+// Requests the streaming predicate picks are handed out as soon as their headers are in, and their
+// body follows piece by piece as it is received; such a body is never buffered, and the body size
+// limit does not apply to it.
+class HttpRequestStream
+{
+public:
+    using StreamsBody = std::function<bool(const HttpRequestView&)>;
+
+    explicit HttpRequestStream(HttpParserLimits t_limits = {}, StreamsBody t_streams_body = nullptr)
+        : m_parser(t_limits), m_streams_body(std::move(t_streams_body)) {}
+
+    // Appends every request and body piece completed by t_data to t_items, in arrival order
+    auto feed(std::string_view t_data, std::vector<HttpStreamItem>& t_items)
+        -> HttpStreamStatus;
+
+    // Bytes of an unfinished request held until more arrive
+    auto buffered() const noexcept
+        -> std::size_t
+    {
+        return m_buffer.size();
+    }
+
+    // A streamed body has started and not ended yet
+    auto streaming() const noexcept
+        -> bool
+    {
+        return m_streaming;
+    }
+
+private:
+    // Hands out the part of t_data that belongs to the streamed body and returns the rest
+    auto feed_body(std::string_view t_data, std::vector<HttpStreamItem>& t_items)
+        -> std::string_view;
+
+    HttpParser m_parser;
+    StreamsBody m_streams_body;
+    std::string m_buffer;
+    HttpStreamStatus m_status = HttpStreamStatus::open;
+
+    // The request being parsed was already offered to the predicate and is read whole
+    bool m_buffers_body = false;
+
+    // State of the body being streamed, if any
+    bool m_streaming = false;
+    bool m_keep_alive_after_body = true;
+    bool m_chunked = false;
+    std::size_t m_body_remaining = 0;
+    details::ChunkedDecoder m_chunked_decoder;
+};
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+struct HttpHeaderView
+{
+    std::string_view name;
+    std::string_view value;
+};
+
+// Request whose fields point into the buffer it was parsed from; only valid while that buffer is
+struct HttpRequestView
+{
+    static constexpr std::size_t max_headers = 32;
+
+    std::string_view method;
+    std::string_view path;
+    std::string_view version;
+    std::array<HttpHeaderView, max_headers> header_storage{};
+    std::size_t header_count = 0;
+    std::string_view body;
+
+    auto headers() const noexcept
+        -> std::span<const HttpHeaderView>
+    {
+        return {header_storage.data(), header_count};
+    }
+
+    // Header names are matched case-insensitively; the first occurrence wins
+    auto header(std::string_view t_name) const noexcept
+        -> std::optional<std::string_view>;
+
+    // HTTP/1.1 keeps the connection open unless the client sent "Connection: close"; HTTP/1.0 only
+    // keeps it when asked with "Connection: keep-alive" (RFC 9112, 9.3)
+    auto keep_alive() const noexcept
+        -> bool;
+
+    // Owning copy for code that has to outlive the receive buffer
+    auto to_request() const
+        -> HttpRequest;
+};
+}
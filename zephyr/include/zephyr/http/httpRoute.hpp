@@ -0,0 +1,73 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <span>
+#include <stdexec/execution.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "zephyr/context/context.hpp"
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/common/anySender.hpp"
+
+namespace zephyr::http
+{
+class HttpRoute
+{
+public:
+    using HttpSender = common::any_sender_of<
+        stdexec::set_value_t(HttpResponse),
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()
+    >;
+
+    using Handler = std::function<HttpSender(const HttpRequest&, const context::Context)>;
+
+    template<typename H>
+    HttpRoute(std::string t_method, std::string t_pattern, H t_handler, bool t_streams_body = false)
+        : m_method(std::move(t_method)), m_pattern(std::move(t_pattern)), m_handler(std::move(t_handler)),
+          m_streams_body(t_streams_body)
+    {
+        collect_param_names();
+    }
+
+    auto method() const noexcept
+        -> const std::string&
+    {
+        return m_method;
+    }
+
+    auto pattern() const noexcept
+        -> const std::string&
+    {
+        return m_pattern;
+    }
+
+    // The handler reads the request body from HttpRequest::body_stream instead of getting it whole
+    auto streams_body() const noexcept
+        -> bool
+    {
+        return m_streams_body;
+    }
+
+    // Stores the values the router captured for this route's :params, in pattern order
+    auto bind_params(HttpRequest& t_request, std::span<const std::string_view> t_values) const
+        -> void;
+
+    auto invoke(HttpRequest t_request, const context::Context& t_context) const
+        -> HttpSender;
+
+private:
+    auto collect_param_names()
+        -> void;
+
+    std::string m_method;
+    std::string m_pattern;
+    std::vector<std::string> m_param_names;
+    Handler m_handler;
+    bool m_streams_body = false;
+};
+}
+
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "zephyr/context/context.hpp"
+#include "zephyr/http/details/radixTree.hpp"
+#include "zephyr/http/httpRoute.hpp"
+#include "zephyr/http/staticFiles.hpp"
+
+#include <memory>
+#include <stdexec/execution.hpp>
+#include <string_view>
+#include <vector>
+
+namespace zephyr::http
+{
+class HttpRouter
+{
+    using HttpSender = HttpRoute::HttpSender;
+
+public:
+    HttpRouter(): m_context(std::make_shared<context::Context>()) {}
+
+    template<typename T>
+    auto add_resource(const std::string& t_name, std::shared_ptr<T> t_resource)
+        -> void
+    {
+        m_context->set(t_name, t_resource);
+    }
+
+    template<typename SyncHandler>
+    auto add_route(std::string t_method, std::string t_path, SyncHandler t_handler)
+    {
+        auto async_handler
+            = [h = std::move(t_handler)] (const HttpRequest& t_request, const context::Context& t_context) {
+            return HttpSender{stdexec::just(h(t_request, t_context))};
+        };
+
+        add(HttpRoute{std::move(t_method), std::move(t_path), std::move(async_handler)});
+    }
+
+    auto get(std::string t_path, auto t_handler)
+        -> void
+    {
+        add_route("GET", std::move(t_path), std::move(t_handler));
+    }
+
+    auto post(std::string t_path, auto t_handler)
+        -> void
+    {
+        add_route("POST", std::move(t_path), std::move(t_handler));
+    }
+
+    template<typename AsyncHandler>
+    auto get_async(std::string t_path, AsyncHandler t_handler)
+        -> void
+    {
+        add(HttpRoute{
+            "GET",
+            std::move(t_path),
+            [h = std::move(t_handler)](const HttpRequest& t_request, const context::Context& t_context) {
+                return HttpSender{h(t_request, t_context)};
+            }
+        });
+    }
+
+    // The handler starts as soon as the request headers are in and reads the body from
+    // request.body_stream while it is received, so an upload of any size is never held in memory whole
+    template<typename AsyncHandler>
+    auto add_streaming_route(std::string t_method, std::string t_path, AsyncHandler t_handler)
+        -> void
+    {
+        add(HttpRoute{
+            std::move(t_method),
+            std::move(t_path),
+            [h = std::move(t_handler)](const HttpRequest& t_request, const context::Context& t_context) {
+                return HttpSender{h(t_request, t_context)};
+            },
+            true
+        });
+    }
+
+    auto post_stream(std::string t_path, auto t_handler)
+        -> void
+    {
+        add_streaming_route("POST", std::move(t_path), std::move(t_handler));
+    }
+
+    auto put_stream(std::string t_path, auto t_handler)
+        -> void
+    {
+        add_streaming_route("PUT", std::move(t_path), std::move(t_handler));
+    }
+
+    // GET and HEAD for everything under t_url_prefix, served from the files under t_root
+    auto static_files(std::string t_url_prefix, std::string t_root, StaticFileOptions t_options = {})
+        -> void
+    {
+        auto pattern = t_url_prefix.ends_with('/') ? t_url_prefix + "*" : t_url_prefix + "/*";
+        StaticFiles files{std::move(t_url_prefix), std::move(t_root), std::move(t_options)};
+        add_route("GET", pattern, files);
+        add_route("HEAD", std::move(pattern), std::move(files));
+    }
+
+    // The query string is not part of the match
+    auto route(HttpRequest t_request) const
+        -> HttpSender;
+
+    // Whether the request goes to a route registered with add_streaming_route()
+    auto streams_body(std::string_view t_method, std::string_view t_path) const
+        -> bool;
+
+private:
+    // Throws std::invalid_argument for patterns the tree cannot hold (see RadixTree::insert)
+    auto add(HttpRoute t_route)
+        -> void;
+
+    std::vector<HttpRoute> m_routes;
+    details::RadixTree m_tree;
+    std::shared_ptr<context::Context> m_context;
+    // Lets streams_body() skip the lookup on routers without streaming routes
+    bool m_has_streaming_routes = false;
+};
+}
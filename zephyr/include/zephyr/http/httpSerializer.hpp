@@ -0,0 +1,50 @@
+#pragma once
+
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/io/gatherBuffer.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace zephyr::http
+{
+class HttpSerializer
+{
+public:
+    static auto serialize(const HttpResponse& t_response)
+        -> std::string;
+
+    // Status line, header block and body as separate segments for one gather write. Common status
+    // lines are static text and the body is moved, not copied. For a response with a body producer
+    // only the head is written, as serialize_head() does, chunked unless it has a Content-Length;
+    // for a file body, only the head with the region's length. A prerendered response shares its
+    // head and body with every other write of it.
+    static auto serialize_vectored(HttpResponse t_response)
+        -> io::GatherBuffer;
+
+    // Renders a response once so it can be written any number of times, as a prerendered
+    // response: Content-Length and Date are fixed at this point, the blank line after the headers
+    // is left out so each write can add its own (Connection, Age). Only for responses with a body
+    // in t_response.body.
+    static auto prerender(HttpResponse t_response)
+        -> PrerenderedResponse;
+
+    // Status line and headers of a response whose body is streamed after them. With t_chunked the
+    // head announces chunked framing and every piece has to go through chunk(); otherwise the body
+    // is delimited by its Content-Length header or by closing the connection.
+    static auto serialize_head(const HttpResponse& t_response, bool t_chunked)
+        -> io::GatherBuffer;
+
+    // One piece of a chunked body: hex size line, the data and CRLF. Empty data is not a chunk,
+    // since that would end the body, so it gives an empty buffer.
+    static auto chunk(std::string t_data)
+        -> io::GatherBuffer;
+
+    // Ends a chunked body, without trailers
+    static constexpr std::string_view last_chunk = "0\r\n\r\n";
+
+    // Pre-rendered "HTTP/1.1 <code> <reason>\r\n", or empty when the code or reason is not a standard pair
+    static auto status_line(int t_status_code, std::string_view t_status_text) noexcept
+        -> std::string_view;
+};
+}
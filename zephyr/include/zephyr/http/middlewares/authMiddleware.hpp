@@ -1,7 +1,9 @@
 #pragma once
 
 #include <stdexec/execution.hpp>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "zephyr/common/resultSender.hpp"
 #include "zephyr/http/httpMessages.hpp"
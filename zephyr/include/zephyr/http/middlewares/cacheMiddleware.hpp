@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdexec/execution.hpp>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "zephyr/common/callbackSender.hpp"
+#include "zephyr/common/rendezvous.hpp"
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/http/httpMessages.hpp"
+#include "zephyr/http/middlewares/httpMiddlewaresConcept.hpp"
+#include "zephyr/http/responseCache.hpp"
+
+namespace zephyr::http
+{
+// Answers GET requests from t_cache. A hit is the stored serialized response and never reaches the
+// stages behind this one; a miss runs them once for every request that arrives while it is in
+// flight. Added first, hits skip the router and all other middlewares; anything that has to see
+// every request (authentication, logging) goes before it. Pipelines built from one builder share
+// the cache, so every connection sees the same entries.
+inline auto cache_middleware(std::shared_ptr<ResponseCache> t_cache) {
+    return [cache = std::move(t_cache)](HttpRequest req, HttpNext next) -> common::ResultSender<HttpResponse> {
+        auto key = cache->key(req);
+        if (key.empty()) {
+            return next(std::move(req));
+        }
+
+        HttpResponse hit;
+        auto joined = std::make_shared<common::Rendezvous<std::optional<HttpResponse>>>();
+
+        switch (cache->lookup(key, hit, [joined](std::optional<HttpResponse> t_response) {
+            joined->push(std::move(t_response), nullptr);
+        })) {
+        case CacheLookup::hit:
+            return common::ResultSender<HttpResponse>{stdexec::just(std::move(hit))};
+
+        case CacheLookup::joined:
+            // Without a response to share, the request runs the stages behind like any other
+            return common::ResultSender<HttpResponse>{
+                common::from_callback<std::optional<HttpResponse>>([joined](common::Completion<std::optional<HttpResponse>> t_done) {
+                    joined->pull(std::move(t_done));
+                })
+                | stdexec::let_value([next = std::move(next), req = std::move(req)](std::optional<HttpResponse>& t_response) mutable {
+                    if (t_response) {
+                        return common::ResultSender<HttpResponse>{stdexec::just(std::move(*t_response))};
+                    }
+                    return next(std::move(req));
+                })
+            };
+
+        case CacheLookup::miss:
+            break;
+        }
+
+        return common::ResultSender<HttpResponse>{
+            next(std::move(req))
+            | stdexec::then([cache, key](HttpResponse t_response) {
+                return cache->complete(key, std::move(t_response));
+            })
+            | stdexec::let_error([cache, key](std::exception_ptr t_error) {
+                cache->abandon(key);
+                return stdexec::just_error(t_error);
+            })
+            | stdexec::let_stopped([cache, key] {
+                cache->abandon(key);
+                return stdexec::just_stopped();
+            })
+        };
+    };
+}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <utility>
+
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+template<typename F>
+concept HttpMiddlewareConcept = requires(F f, HttpRequest req) {
+    { f(std::move(req)) } -> std::convertible_to<common::ResultSender<http::HttpRequest>>;
+};
+
+// The rest of the pipeline behind a wrapping middleware
+using HttpNext = std::function<common::ResultSender<HttpResponse>(HttpRequest)>;
+
+// A middleware that wraps the rest of the pipeline instead of passing the request on: it may
+// answer without calling next, or look at the response next produces
+template<typename F>
+concept HttpWrappingMiddlewareConcept = requires(F f, HttpRequest req, HttpNext next) {
+    { f(std::move(req), std::move(next)) } -> std::convertible_to<common::ResultSender<http::HttpResponse>>;
+};
+}
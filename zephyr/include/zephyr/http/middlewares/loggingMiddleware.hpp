@@ -2,6 +2,7 @@
 
 #include <stdexec/execution.hpp>
 #include <iostream>
+#include <utility>
 
 #include "zephyr/common/resultSender.hpp"
 #include "zephyr/http/httpMessages.hpp"
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+struct ResponseCacheOptions
+{
+    // Independently locked parts of the cache; a key always lands in the same one
+    std::size_t shards = 16;
+    // Bytes of keys, heads and bodies across all shards, split evenly between them
+    std::size_t max_bytes = 64 * 1024 * 1024;
+    // Larger responses are never stored
+    std::size_t max_entry_bytes = 1024 * 1024;
+    std::chrono::milliseconds ttl{5000};
+    // Request headers whose values are part of the key, like Accept-Encoding
+    std::vector<std::string> key_headers;
+};
+
+enum class CacheLookup
+{
+    // The stored response was returned
+    hit,
+    // The caller is the first to ask: it produces the response and passes it to complete(), or
+    // calls abandon() when it cannot
+    miss,
+    // Another request is producing the response; the waiter is called once it is done
+    joined
+};
+
+// Serialized GET responses, shared by all connections. Each shard is an LRU with its own lock and
+// byte budget, and entries expire a fixed time after they were stored. Concurrent misses on one
+// key are collapsed: the first request runs the handler and the others wait for its response.
+class ResponseCache
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Called with the response a joined request gets, or nullopt when the response could not be
+    // cached and the request has to run the handler itself
+    using Waiter = std::function<void(std::optional<HttpResponse>)>;
+
+    explicit ResponseCache(ResponseCacheOptions t_options = {});
+
+    // Empty when the request may not be answered from the cache
+    auto key(const HttpRequest& t_request) const
+        -> std::string;
+
+    // Fills t_hit on a hit; t_waiter is kept only when the request joins one in flight
+    auto lookup(const std::string& t_key, HttpResponse& t_hit, Waiter t_waiter)
+        -> CacheLookup;
+
+    // Called by the request that missed. Stores t_response when it is cacheable and hands it to
+    // the joined requests; returns the response to send.
+    auto complete(const std::string& t_key, HttpResponse t_response)
+        -> HttpResponse;
+
+    // The request that missed has no response; the joined ones run the handler themselves
+    auto abandon(const std::string& t_key)
+        -> void;
+
+    // Whether a response may be stored: a status cacheable by default, a body in memory, no
+    // cookie and nothing in Cache-Control against it
+    static auto cacheable(const HttpResponse& t_response)
+        -> bool;
+
+    auto size() const
+        -> std::size_t;
+
+    auto bytes() const
+        -> std::size_t;
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<const PrerenderedResponse> response;
+        Clock::time_point stored;
+        std::size_t bytes = 0;
+        std::list<std::string>::iterator position;
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        // Most recently used first
+        std::list<std::string> order;
+        std::unordered_map<std::string, Entry> entries;
+        std::unordered_map<std::string, std::vector<Waiter>> in_flight;
+        std::size_t bytes = 0;
+    };
+
+    auto shard_for(const std::string& t_key) const
+        -> Shard&;
+
+    // Takes the waiters for t_key and, with t_response, stores it
+    auto finish(const std::string& t_key, std::shared_ptr<const PrerenderedResponse> t_response)
+        -> std::vector<Waiter>;
+
+    static auto erase(Shard& t_shard, std::unordered_map<std::string, Entry>::iterator t_entry)
+        -> void;
+
+    static auto respond(std::shared_ptr<const PrerenderedResponse> t_response)
+        -> HttpResponse;
+
+    ResponseCacheOptions m_options;
+    std::size_t m_shard_bytes;
+    std::unique_ptr<Shard[]> m_shards;
+};
+}
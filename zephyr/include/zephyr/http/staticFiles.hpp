@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "zephyr/context/context.hpp"
+#include "zephyr/http/details/openFileCache.hpp"
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+struct StaticFileOptions
+{
+    // Descriptors kept open between requests
+    std::size_t max_open_files = 256;
+    // How long a file's stat result is trusted before it is checked again
+    std::chrono::milliseconds revalidate_after{1000};
+    // Served for the prefix itself and for paths ending in '/'
+    std::string index_file = "index.html";
+    // Sent as Cache-Control when not empty
+    std::string cache_control;
+};
+
+// Serves the files under a directory, mapping t_url_prefix/<path> to t_root/<path>. The body is
+// never read by the server: the response carries a region of the cached descriptor, which the
+// session splices to the socket. Answers If-None-Match with 304 and a single-range Range header
+// with 206; a request with several ranges gets the whole file.
+//
+// Copies share the open-file cache, so the handler can be stored in any route table.
+class StaticFiles
+{
+public:
+    StaticFiles(std::string t_url_prefix, std::string t_root, StaticFileOptions t_options = {});
+
+    auto operator()(const HttpRequest& t_request, const context::Context& t_context) const
+        -> HttpResponse;
+
+    // Content-Type for a file name, by extension; application/octet-stream for unknown ones
+    static auto content_type(std::string_view t_path)
+        -> std::string_view;
+
+private:
+    // File system path for t_path, or empty when the request tries to leave the root
+    auto resolve(std::string_view t_path) const
+        -> std::string;
+
+    std::string m_url_prefix;
+    std::string m_root;
+    StaticFileOptions m_options;
+    std::shared_ptr<details::OpenFileCache> m_files;
+};
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "zephyr/context/context.hpp"
+#include "zephyr/http/details/radixTree.hpp"
+#include "zephyr/http/details/staticRouteTable.hpp"
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+// One entry of a StaticRouter. Method and pattern are part of the type so the whole table is known
+// at compile time; the handler keeps its own type and is called directly.
+template<details::FixedString Method, details::FixedString Pattern, typename Handler>
+struct StaticRoute
+{
+    static constexpr std::string_view method = Method.view();
+    static constexpr std::string_view pattern = Pattern.view();
+    static constexpr std::size_t max_params = details::RouteMatch::max_params;
+    static constexpr auto param_names = details::param_names<max_params>(pattern);
+
+    static_assert(details::is_valid_pattern(pattern),
+                  "route patterns start with '/', name every :param and only end with '*'");
+    static_assert(details::param_count(pattern) <= max_params, "too many :params in a route pattern");
+
+    Handler handler;
+};
+
+// Handler is called as HttpResponse(const HttpRequest&, const context::Context&)
+template<details::FixedString Method, details::FixedString Pattern, typename Handler>
+constexpr auto route(Handler t_handler)
+    -> StaticRoute<Method, Pattern, Handler>
+{
+    return {std::move(t_handler)};
+}
+
+// Route table resolved at compile time. Static patterns are found through a perfect hash built
+// during compilation; patterns with :params or "*" are tried afterwards in declaration order.
+// A method and pattern declared twice is a compile error rather than a dead route.
+template<typename... Routes>
+class StaticRouter
+{
+    static constexpr std::size_t route_count = sizeof...(Routes);
+    static constexpr std::array<details::RouteKey, route_count> keys{{{Routes::method, Routes::pattern}...}};
+
+    static_assert(!details::has_duplicate_routes(keys), "a route is declared twice; the second one is unreachable");
+
+    static constexpr bool has_static_routes
+        = ((details::is_static_pattern(Routes::pattern) && Routes::method != "*") || ...);
+    static constexpr auto static_table = details::build_perfect_hash(keys);
+
+public:
+    constexpr explicit StaticRouter(Routes... t_routes)
+        : m_routes(std::move(t_routes)...) {}
+
+    // The query string is not part of the match
+    auto route(HttpRequest t_request, const context::Context& t_context) const
+        -> HttpResponse
+    {
+        std::string_view path = t_request.path;
+        path = path.substr(0, path.find('?'));
+
+        HttpResponse response;
+
+        if constexpr (has_static_routes) {
+            const auto index = static_table.find(t_request.method, path);
+            if (index < route_count && keys[index].method == t_request.method && keys[index].pattern == path) {
+                invoke_static(index, t_request, t_context, response, std::index_sequence_for<Routes...>{});
+                return response;
+            }
+        }
+
+        if (try_dynamic(t_request, path, t_context, response, std::index_sequence_for<Routes...>{})) {
+            return response;
+        }
+
+        return HttpResponse::not_found();
+    }
+
+private:
+    template<std::size_t... I>
+    auto invoke_static(std::size_t t_index, const HttpRequest& t_request, const context::Context& t_context,
+                       HttpResponse& t_response, std::index_sequence<I...>) const -> void
+    {
+        // Expands to a switch over the static routes
+        (void)((t_index == I && is_static<I>() && (t_response = call<I>(t_request, t_context), true)) || ...);
+    }
+
+    template<std::size_t... I>
+    auto try_dynamic(HttpRequest& t_request, std::string_view t_path, const context::Context& t_context,
+                     HttpResponse& t_response, std::index_sequence<I...>) const -> bool
+    {
+        return (try_route<I>(t_request, t_path, t_context, t_response) || ...);
+    }
+
+    template<std::size_t I>
+    auto try_route(HttpRequest& t_request, std::string_view t_path, const context::Context& t_context,
+                   HttpResponse& t_response) const -> bool
+    {
+        using Route = std::tuple_element_t<I, std::tuple<Routes...>>;
+
+        if constexpr (is_static<I>()) {
+            return false;
+        } else {
+            if constexpr (Route::method != "*") {
+                if (t_request.method != Route::method) {
+                    return false;
+                }
+            }
+
+            std::array<std::string_view, Route::max_params> values{};
+            if (!details::match_pattern(Route::pattern, t_path, values)) {
+                return false;
+            }
+
+            // The values point into t_request.path, so they are copied out before the handler runs
+            t_request.path_params.clear();
+            for (std::size_t i = 0; i < details::param_count(Route::pattern); ++i) {
+                t_request.path_params.emplace(std::string{Route::param_names[i]}, std::string{values[i]});
+            }
+
+            t_response = call<I>(t_request, t_context);
+            return true;
+        }
+    }
+
+    template<std::size_t I>
+    static constexpr auto is_static() noexcept
+        -> bool
+    {
+        return details::is_static_pattern(keys[I].pattern) && keys[I].method != "*";
+    }
+
+    template<std::size_t I>
+    auto call(const HttpRequest& t_request, const context::Context& t_context) const
+        -> HttpResponse
+    {
+        return std::get<I>(m_routes).handler(t_request, t_context);
+    }
+
+    std::tuple<Routes...> m_routes;
+};
+}
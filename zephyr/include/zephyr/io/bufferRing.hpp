@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <liburing.h>
+
+namespace zephyr::io
+{
+class BufferRing;
+class IoUringContext;
+
+// View over a received chunk. A buffer picked by the kernel from a BufferRing goes back to
+// the ring when the view is destroyed, so consumers must not keep pointers into it afterwards.
+class ProvidedBuffer
+{
+public:
+    ProvidedBuffer() noexcept = default;
+    ProvidedBuffer(BufferRing* t_ring, uint16_t t_id, std::span<std::byte> t_data) noexcept
+        : m_ring(t_ring),
+          m_id(t_id),
+          m_data(t_data)
+    {}
+
+    // Non-owning view over memory the caller keeps alive
+    static auto borrowed(std::span<std::byte> t_data) noexcept -> ProvidedBuffer
+    {
+        return ProvidedBuffer{nullptr, 0, t_data};
+    }
+
+    ProvidedBuffer(const ProvidedBuffer&) = delete;
+    ProvidedBuffer& operator=(const ProvidedBuffer&) = delete;
+
+    ProvidedBuffer(ProvidedBuffer&& t_other) noexcept
+        : m_ring(std::exchange(t_other.m_ring, nullptr)),
+          m_id(t_other.m_id),
+          m_data(std::exchange(t_other.m_data, {}))
+    {}
+
+    ProvidedBuffer& operator=(ProvidedBuffer&& t_other) noexcept
+    {
+        if (this != &t_other) {
+            release();
+            m_ring = std::exchange(t_other.m_ring, nullptr);
+            m_id = t_other.m_id;
+            m_data = std::exchange(t_other.m_data, {});
+        }
+        return *this;
+    }
+
+    ~ProvidedBuffer()
+    {
+        release();
+    }
+
+    [[nodiscard]] auto data() const noexcept -> std::span<const std::byte>
+    {
+        return m_data;
+    }
+
+    // The holder owns the buffer until release(), so it may parse or rewrite it in place
+    [[nodiscard]] auto mutable_data() noexcept -> std::span<std::byte>
+    {
+        return m_data;
+    }
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view
+    {
+        return {reinterpret_cast<const char*>(m_data.data()), m_data.size()};
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return m_data.size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return m_data.empty();
+    }
+
+    operator std::string_view() const noexcept
+    {
+        return view();
+    }
+
+    auto release() noexcept -> void;
+
+private:
+    BufferRing* m_ring{nullptr};
+    uint16_t m_id{0};
+    std::span<std::byte> m_data{};
+};
+
+// Pool of equally sized receive buffers shared with the kernel (io_uring_setup_buf_ring).
+// Receives armed with the ring's group id let the kernel pick a buffer only when data arrives,
+// so idle sockets hold no memory. Buffers may be recycled from any thread.
+class BufferRing
+{
+public:
+    // t_count has to be a power of two
+    BufferRing(IoUringContext& t_context, uint32_t t_count, uint32_t t_buffer_size);
+    ~BufferRing();
+
+    BufferRing(const BufferRing&) = delete;
+    BufferRing(BufferRing&&) = delete;
+    BufferRing& operator=(const BufferRing&) = delete;
+    BufferRing& operator=(BufferRing&&) = delete;
+
+    [[nodiscard]] auto group_id() const noexcept -> uint16_t
+    {
+        return m_group;
+    }
+
+    [[nodiscard]] auto buffer_size() const noexcept -> uint32_t
+    {
+        return m_buffer_size;
+    }
+
+    // Wraps the buffer selected for a CQE (IORING_CQE_F_BUFFER) holding t_length bytes
+    [[nodiscard]] auto take(uint32_t t_cqe_flags, std::size_t t_length) noexcept -> ProvidedBuffer;
+
+    auto recycle(uint16_t t_id) noexcept -> void;
+
+    // Runs t_callback once after the next buffer is recycled; used to re-arm receives after ENOBUFS
+    auto when_available(std::function<void()> t_callback) -> void;
+
+private:
+    IoUringContext& m_context;
+    uint16_t m_group;
+    uint32_t m_count;
+    uint32_t m_buffer_size;
+    int m_mask;
+    io_uring_buf_ring* m_ring{nullptr};
+    std::unique_ptr<std::byte[]> m_storage;
+    std::atomic<uint32_t> m_outstanding{0};
+    std::mutex m_mutex;
+    std::vector<std::function<void()>> m_waiters;
+};
+
+inline auto ProvidedBuffer::release() noexcept -> void
+{
+    if (m_ring != nullptr) {
+        std::exchange(m_ring, nullptr)->recycle(m_id);
+    }
+    m_data = {};
+}
+}  // namespace zephyr::io
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace zephyr::io
+{
+// Part of an open file, written to a socket with splice so its bytes never pass through user space.
+// The owner keeps the descriptor open until the write is done.
+struct FileRegion
+{
+    int32_t fd = -1;
+    uint64_t offset = 0;
+    std::size_t length = 0;
+    std::shared_ptr<const void> owner;
+};
+}  // namespace zephyr::io
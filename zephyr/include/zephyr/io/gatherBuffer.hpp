@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace zephyr::io
+{
+// Outgoing bytes as a list of segments written with one sendmsg. A segment borrows text with
+// static storage (pre-rendered protocol fragments), shares an immutable string with whoever else
+// writes it (cached responses) or owns a string that was moved in, so large payloads reach the
+// socket without being copied into one combined buffer. Past
+// MAX_SEGMENTS further bytes are copied onto the last segment, which keeps the vector count
+// well under IOV_MAX however many responses are batched.
+class GatherBuffer
+{
+public:
+    static constexpr std::size_t MAX_SEGMENTS = 64;
+
+    GatherBuffer() = default;
+
+    // Single owned segment, for pipelines that already produce one string
+    GatherBuffer(std::string t_data)
+    {
+        append(std::move(t_data));
+    }
+
+    // t_text must outlive every write of this buffer; empty text is skipped
+    auto append_static(std::string_view t_text) -> void
+    {
+        if (t_text.empty()) {
+            return;
+        }
+
+        if (m_segments.size() == MAX_SEGMENTS) {
+            coalesce(t_text);
+        } else {
+            m_segments.push_back({.borrowed = t_text});
+        }
+    }
+
+    // t_text is kept alive by the buffer; an empty or null one is skipped
+    auto append_shared(std::shared_ptr<const std::string> t_text) -> void
+    {
+        if (!t_text || t_text->empty()) {
+            return;
+        }
+
+        if (m_segments.size() == MAX_SEGMENTS) {
+            coalesce(*t_text);
+        } else {
+            m_segments.push_back({.shared = std::move(t_text)});
+        }
+    }
+
+    auto append(std::string t_data) -> void
+    {
+        if (t_data.empty()) {
+            return;
+        }
+
+        if (m_segments.size() == MAX_SEGMENTS) {
+            coalesce(t_data);
+        } else {
+            m_segments.push_back({.owned = std::move(t_data)});
+        }
+    }
+
+    // Moves t_other's segments behind this buffer's
+    auto append(GatherBuffer&& t_other) -> void
+    {
+        if (m_segments.empty()) {
+            m_segments = std::move(t_other.m_segments);
+            return;
+        }
+
+        for (auto& segment : t_other.m_segments) {
+            if (m_segments.size() == MAX_SEGMENTS) {
+                coalesce(segment.view());
+            } else {
+                m_segments.push_back(std::move(segment));
+            }
+        }
+        t_other.m_segments.clear();
+    }
+
+    // Drops the first t_bytes, once a write has taken only part of the buffer. Whole segments go;
+    // a segment cut in two keeps only its unwritten tail, a shared one by moving its offset, so a
+    // large cached body is never copied however many short writes it takes.
+    auto consume(std::size_t t_bytes) -> void
+    {
+        std::size_t written = 0;
+        while (written < m_segments.size() && m_segments[written].view().size() <= t_bytes) {
+            t_bytes -= m_segments[written].view().size();
+            ++written;
+        }
+        m_segments.erase(m_segments.begin(), m_segments.begin() + static_cast<std::ptrdiff_t>(written));
+
+        if (t_bytes == 0 || m_segments.empty()) {
+            return;
+        }
+
+        auto& first = m_segments.front();
+        if (!first.borrowed.empty()) {
+            first.borrowed.remove_prefix(t_bytes);
+        } else if (first.shared) {
+            first.offset += t_bytes;
+        } else {
+            first.owned.erase(0, t_bytes);
+        }
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return m_segments.empty();
+    }
+
+    [[nodiscard]] auto segment_count() const noexcept -> std::size_t
+    {
+        return m_segments.size();
+    }
+
+    [[nodiscard]] auto segment(std::size_t t_index) const noexcept -> std::string_view
+    {
+        return m_segments[t_index].view();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        std::size_t total = 0;
+        for (const auto& segment : m_segments) {
+            total += segment.view().size();
+        }
+        return total;
+    }
+
+    // Built on demand because moving the buffer moves short owned strings; the vectors stay valid
+    // until the buffer is moved or modified
+    [[nodiscard]] auto vectors() -> std::span<const iovec>
+    {
+        m_vectors.resize(m_segments.size());
+        for (std::size_t i = 0; i < m_segments.size(); ++i) {
+            const auto text = m_segments[i].view();
+            m_vectors[i] = {.iov_base = const_cast<char*>(text.data()), .iov_len = text.size()};
+        }
+        return m_vectors;
+    }
+
+    // Copies every segment into one string, for transports without gather writes
+    [[nodiscard]] auto flatten() const -> std::string
+    {
+        std::string result;
+        result.reserve(size());
+        for (const auto& segment : m_segments) {
+            result += segment.view();
+        }
+        return result;
+    }
+
+private:
+    struct Segment
+    {
+        std::string_view borrowed{};
+        std::shared_ptr<const std::string> shared{};
+        // Bytes of the shared string already written
+        std::size_t offset{0};
+        std::string owned{};
+
+        auto view() const noexcept -> std::string_view
+        {
+            if (!borrowed.empty()) {
+                return borrowed;
+            }
+            return shared ? std::string_view{*shared}.substr(offset) : std::string_view{owned};
+        }
+    };
+
+    auto coalesce(std::string_view t_text) -> void
+    {
+        auto& last = m_segments.back();
+        if (!last.borrowed.empty()) {
+            last.owned = std::exchange(last.borrowed, {});
+        } else if (last.shared) {
+            last.owned = last.view();
+            last.shared.reset();
+            last.offset = 0;
+        }
+        last.owned += t_text;
+    }
+
+    std::vector<Segment> m_segments;
+    std::vector<iovec> m_vectors;
+};
+}  // namespace zephyr::io
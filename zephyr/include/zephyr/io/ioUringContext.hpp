@@ -0,0 +1,1026 @@
+#pragma once
+
+#include <stdexec/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <liburing.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "zephyr/io/timerWheel.hpp"
+
+namespace zephyr::io
+{
+class IoUringContext;
+
+// Socket referenced either by a regular descriptor or by its slot in the ring's registered file table
+struct FileHandle
+{
+    constexpr FileHandle(int32_t t_fd, bool t_fixed = false) noexcept : fd(t_fd), fixed(t_fixed) {}
+
+    static constexpr auto fixed_slot(int32_t t_index) noexcept -> FileHandle
+    {
+        return FileHandle{t_index, true};
+    }
+
+    int32_t fd;
+    bool fixed;
+};
+
+namespace details
+{
+// Every SQE owned by an operation carries a pointer to its IoOperationBase in user_data.
+// SQEs submitted by the context itself (wake-ups, cancellations) carry nullptr and are skipped.
+struct IoOperationBase
+{
+    using CompleteFn = void (*)(IoOperationBase*, int32_t, uint32_t) noexcept;
+
+    CompleteFn complete{nullptr};
+
+    // Guarded by the submission lock. A cancel that comes before the SQE has been submitted
+    // cannot be matched by the kernel, so it is remembered and the submission is refused instead.
+    bool submitted{false};
+    bool cancelled{false};
+};
+
+template <typename Prep, typename Receiver>
+class IoOperation;
+
+// A timer owned by a sender. Guarded by the timer lock, the way IoOperationBase is by the
+// submission lock: a cancel that comes before the timer is in the wheel finds nothing to remove,
+// so it is remembered and the timer is never scheduled.
+struct TimerOperationBase : TimerNode
+{
+    bool scheduled{false};
+    bool cancelled{false};
+};
+
+template <typename Receiver>
+class TimerOperation;
+
+// Operations whose result CQE is followed by a notification CQE (IORING_CQE_F_NOTIF)
+template <typename Prep>
+concept NotifyingPrep = Prep::NOTIFIES;
+
+inline auto prep_file(io_uring_sqe* t_sqe, FileHandle t_file) noexcept -> void
+{
+    if (t_file.fixed) {
+        t_sqe->flags |= IOSQE_FIXED_FILE;
+    }
+}
+}  // namespace details
+
+// True when a multishot operation stays armed after the CQE carrying these flags
+[[nodiscard]] constexpr auto has_more(uint32_t t_flags) noexcept -> bool
+{
+    return (t_flags & IORING_CQE_F_MORE) != 0;
+}
+
+template <typename Prep, typename Handler>
+class MultishotOperation;
+
+class IoUringContext
+{
+public:
+    static constexpr uint32_t COMPLETION_BATCH_SIZE = 64;
+
+    explicit IoUringContext(uint32_t t_entries = 256);
+    ~IoUringContext();
+
+    IoUringContext(const IoUringContext&) = delete;
+    IoUringContext(IoUringContext&&) = delete;
+    IoUringContext& operator=(const IoUringContext&) = delete;
+    IoUringContext& operator=(IoUringContext&&) = delete;
+
+    // Reaps completions until stop() is called and every in-flight operation has completed
+    auto run() -> void
+    {
+        run([] {});
+    }
+
+    // Same as run(); t_on_batch is invoked on the reactor thread after every dispatched batch of
+    // completions, which lets handlers accumulate work per wakeup and flush it in one go
+    template <typename OnBatch>
+    auto run(OnBatch&& t_on_batch) -> void
+    {
+        enter_reactor();
+
+        while (!is_stopped() || m_in_flight.load(std::memory_order_acquire) != 0) {
+            if (run_once() != 0) {
+                t_on_batch();
+            }
+        }
+
+        leave_reactor();
+    }
+
+    // Waits for at least one completion and dispatches up to COMPLETION_BATCH_SIZE of them
+    auto run_once() -> std::size_t;
+
+    // Cancels all in-flight operations and lets run() return once they have completed
+    auto stop() -> void;
+
+    [[nodiscard]] auto is_stopped() const -> bool
+    {
+        return m_stop_requested.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto is_running() const -> bool
+    {
+        return m_reactor_thread.load(std::memory_order_acquire) != std::thread::id{};
+    }
+
+    // True on the thread inside run()
+    [[nodiscard]] auto on_reactor_thread() const -> bool
+    {
+        return std::this_thread::get_id() == m_reactor_thread.load(std::memory_order_acquire);
+    }
+
+    template <typename Prep>
+    class IoSender;
+
+    struct AcceptPrep;
+    struct ReceivePrep;
+    struct SendPrep;
+    struct SendVectorsPrep;
+    struct SendZeroCopyPrep;
+    struct RecvFromPrep;
+    struct SendToPrep;
+    struct PollPrep;
+    struct SplicePrep;
+
+    [[nodiscard]] auto accept(int32_t t_listen_fd) -> IoSender<AcceptPrep>;
+    [[nodiscard]] auto receive(FileHandle t_file, std::span<std::byte> t_buffer) -> IoSender<ReceivePrep>;
+    [[nodiscard]] auto send(FileHandle t_file, std::span<const std::byte> t_buffer) -> IoSender<SendPrep>;
+    // Gather write with sendmsg; the vectors and the memory behind them must stay valid until completion
+    [[nodiscard]] auto send(FileHandle t_file, std::span<const iovec> t_vectors) -> IoSender<SendVectorsPrep>;
+    // Same, but the kernel pins the pages and sends from them instead of copying (IORING_OP_SENDMSG_ZC).
+    // Completes once the kernel has let go of the memory, which may be after the peer acknowledged
+    // it. Worth it for large payloads only; kernels before 6.1 fail it with EINVAL.
+    [[nodiscard]] auto send_zero_copy(FileHandle t_file, std::span<const iovec> t_vectors)
+        -> IoSender<SendZeroCopyPrep>;
+
+    // Registers a sparse table of t_slots direct descriptors. Multishot accepts may then install
+    // new sockets straight into the table and later operations address them with FileHandle::fixed_slot()
+    auto register_files(uint32_t t_slots) -> void;
+    [[nodiscard]] auto has_registered_files() const noexcept -> bool
+    {
+        return m_registered_files != 0;
+    }
+
+    // Closes the descriptor asynchronously; direct descriptors are released from the file table
+    auto close(FileHandle t_file) -> void;
+
+    // Cancels every operation in flight on t_file; each completes with ECANCELED
+    auto cancel(FileHandle t_file) -> void;
+
+    // UDP operations
+    [[nodiscard]] auto recvfrom(int32_t t_fd, std::span<std::byte> t_buffer, sockaddr_in& t_addr)
+        -> IoSender<RecvFromPrep>;
+    [[nodiscard]] auto sendto(int32_t t_fd, std::span<const std::byte> t_buffer, const sockaddr_in& t_addr)
+        -> IoSender<SendToPrep>;
+
+    // Completes with the ready events once t_file reports any of t_events (POLLIN, POLLOUT, ...)
+    [[nodiscard]] auto poll(FileHandle t_file, uint32_t t_events) -> IoSender<PollPrep>;
+
+    // Moves up to t_length bytes from t_in to t_out inside the kernel; one of them must be a pipe.
+    // An offset of -1 uses the descriptor's own position, which pipes and sockets require.
+    [[nodiscard]] auto splice(FileHandle t_in, int64_t t_in_offset, FileHandle t_out, int64_t t_out_offset,
+                              uint32_t t_length) -> IoSender<SplicePrep>;
+
+    // Timers live in a hierarchical wheel per context, advanced by the reactor thread
+    using Clock = TimerWheel::Clock;
+
+    class TimerSender;
+
+    // Completes on the reactor thread once the deadline has passed, or with set_stopped when its
+    // stop token fires or the context stops first
+    [[nodiscard]] auto schedule_at(Clock::time_point t_deadline) -> TimerSender;
+    [[nodiscard]] auto schedule_after(Clock::duration t_delay) -> TimerSender;
+
+    // For deadlines that keep moving, like a connection's idle timeout: schedules t_timer, or moves
+    // it when it is already scheduled, without allocating. t_timer.fire runs on the reactor thread
+    // with the returned generation; 0 means the context is stopping and nothing was scheduled.
+    auto add_timer(TimerNode& t_timer, Clock::time_point t_deadline) -> uint64_t;
+    // True when t_timer was removed before firing; otherwise it has fired or is about to
+    auto cancel_timer(TimerNode& t_timer) -> bool;
+
+private:
+    template <typename Prep, typename Receiver>
+    friend class details::IoOperation;
+
+    template <typename Prep, typename Handler>
+    friend class MultishotOperation;
+
+    template <typename Receiver>
+    friend class details::TimerOperation;
+
+    friend class BufferRing;
+
+    // Prepares one SQE under the submission lock. Submissions from the reactor thread are
+    // flushed together by run_once(), every other thread submits immediately.
+    // Returns 0 on success or an errno value.
+    template <typename Prepare>
+    auto submit(Prepare&& t_prepare) -> int
+    {
+        std::lock_guard lock(m_submit_mutex);
+        return submit_locked(std::forward<Prepare>(t_prepare));
+    }
+
+    template <typename Prepare>
+    auto submit_locked(Prepare&& t_prepare) -> int
+    {
+        auto* sqe = io_uring_get_sqe(&m_ring);
+        if (sqe == nullptr) {
+            io_uring_submit(&m_ring);
+            sqe = io_uring_get_sqe(&m_ring);
+        }
+
+        if (sqe == nullptr) {
+            return EBUSY;
+        }
+
+        std::forward<Prepare>(t_prepare)(sqe);
+
+        if (std::this_thread::get_id() != m_reactor_thread.load(std::memory_order_relaxed)) {
+            io_uring_submit(&m_ring);
+        }
+
+        return 0;
+    }
+
+    // The stop flag and the operation's own cancel are checked under the submission lock, so an
+    // operation either lands before the cancel request issued for it or is rejected with ECANCELED.
+    auto submit_operation(details::IoOperationBase* t_operation, auto&& t_prepare) -> int
+    {
+        std::lock_guard lock(m_submit_mutex);
+        if (is_stopped() || t_operation->cancelled) {
+            return ECANCELED;
+        }
+
+        const auto result = submit_locked([&](io_uring_sqe* t_sqe) {
+            t_prepare(t_sqe);
+            io_uring_sqe_set_data(t_sqe, t_operation);
+        });
+
+        if (result == 0) {
+            t_operation->submitted = true;
+            m_in_flight.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    // Clears what an earlier submission of t_operation left, before a multishot operation is armed again
+    auto reset_operation(details::IoOperationBase* t_operation) -> void
+    {
+        std::lock_guard lock(m_submit_mutex);
+        t_operation->submitted = false;
+        t_operation->cancelled = false;
+    }
+
+    auto enter_reactor() -> void;
+    auto leave_reactor() -> void;
+    // Runs on the reactor thread after every batch; fires what is due, or drops everything once stopped
+    auto expire_timers() -> void;
+    // Called with m_timer_mutex held
+    auto arm_timer_wakeup(Clock::time_point t_deadline) -> void;
+    // Safe to call before t_operation is submitted: its submission then fails with ECANCELED
+    auto cancel_operation(details::IoOperationBase* t_operation) -> void;
+    // add_timer() and cancel_timer() for a sender's timer, whose stop callback may run before the
+    // timer is scheduled. Such a cancel returns false and makes the scheduling return 0.
+    auto add_timer_operation(details::TimerOperationBase* t_timer, Clock::time_point t_deadline) -> uint64_t;
+    auto cancel_timer_operation(details::TimerOperationBase* t_timer) -> bool;
+    // Called with m_timer_mutex held
+    auto add_timer_locked(TimerNode& t_timer, Clock::time_point t_deadline) -> uint64_t;
+    auto allocate_buffer_group() noexcept -> uint16_t
+    {
+        return m_next_buffer_group.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto operation_finished() -> void
+    {
+        m_in_flight.fetch_sub(1, std::memory_order_release);
+    }
+
+    io_uring m_ring{};
+    std::mutex m_submit_mutex;
+    std::atomic<std::thread::id> m_reactor_thread{};
+    std::atomic<bool> m_stop_requested{false};
+    std::atomic<std::size_t> m_in_flight{0};
+    uint32_t m_registered_files{0};
+    std::atomic<uint16_t> m_next_buffer_group{0};
+
+    // One IORING_OP_TIMEOUT wakes the reactor for the wheel's next wakeup, whatever the number of
+    // timers; it is only submitted again when a sooner deadline comes in. Scheduled timers count
+    // as in flight, so run() does not return before they have fired or been dropped.
+    std::mutex m_timer_mutex;
+    TimerWheel m_timers;
+    Clock::time_point m_timer_wakeup{Clock::time_point::max()};
+    __kernel_timespec m_timer_wakeup_spec{};
+    std::vector<ExpiredTimer> m_expired;
+};
+
+namespace details
+{
+template <typename Prep, typename Receiver>
+class IoOperation : public IoOperationBase
+{
+public:
+    IoOperation(IoUringContext* t_context, Prep t_prep, Receiver t_receiver)
+        : m_context(t_context),
+          m_prep(std::move(t_prep)),
+          m_receiver(std::move(t_receiver))
+    {
+        complete = &IoOperation::on_complete;
+    }
+
+    IoOperation(const IoOperation&) = delete;
+    IoOperation(IoOperation&&) = delete;
+    IoOperation& operator=(const IoOperation&) = delete;
+    IoOperation& operator=(IoOperation&&) = delete;
+
+    friend void tag_invoke(stdexec::start_t /*unused*/, IoOperation& t_self) noexcept
+    {
+        t_self.start();
+    }
+
+private:
+    using StopToken = stdexec::stop_token_of_t<stdexec::env_of_t<Receiver>>;
+
+    struct OnStopRequested
+    {
+        IoOperation* self;
+
+        auto operator()() const noexcept -> void
+        {
+            self->request_cancel();
+        }
+    };
+
+    using StopCallback = stdexec::stop_callback_for_t<StopToken, OnStopRequested>;
+
+    auto start() noexcept -> void
+    {
+        auto token = stdexec::get_stop_token(stdexec::get_env(m_receiver));
+        if (token.stop_requested() || m_context->is_stopped()) {
+            stdexec::set_stopped(std::move(m_receiver));
+            return;
+        }
+
+        // Registered first: once submitted, the operation may complete and be gone at any time.
+        // A stop that lands before the submission makes it fail with ECANCELED below.
+        if constexpr (!stdexec::unstoppable_token<StopToken>) {
+            m_stop_callback.emplace(token, OnStopRequested{this});
+        }
+
+        const auto result = m_context->submit_operation(this, [this](io_uring_sqe* t_sqe) { m_prep.prepare(t_sqe); });
+        if (result == 0) {
+            return;
+        }
+
+        m_stop_callback.reset();
+        if (result == ECANCELED) {
+            stdexec::set_stopped(std::move(m_receiver));
+        } else {
+            stdexec::set_error(std::move(m_receiver),
+                               std::make_exception_ptr(std::system_error(result, std::system_category(), Prep::NAME)));
+        }
+    }
+
+    auto request_cancel() noexcept -> void
+    {
+        m_context->cancel_operation(this);
+    }
+
+    static auto on_complete(IoOperationBase* t_base, int32_t t_result, uint32_t t_flags) noexcept -> void
+    {
+        auto* self = static_cast<IoOperation*>(t_base);
+
+        // Zero-copy sends get the result first, then a notification once the buffers are free again
+        if constexpr (NotifyingPrep<Prep>) {
+            if ((t_flags & IORING_CQE_F_NOTIF) != 0) {
+                t_result = self->m_result;
+            } else if (has_more(t_flags)) {
+                self->m_result = t_result;
+                return;
+            }
+        }
+
+        self->m_stop_callback.reset();
+        self->m_context->operation_finished();
+
+        if (t_result == -ECANCELED) {
+            stdexec::set_stopped(std::move(self->m_receiver));
+        } else if (t_result < 0) {
+            stdexec::set_error(std::move(self->m_receiver), std::make_exception_ptr(std::system_error(
+                                                                -t_result, std::system_category(), Prep::NAME)));
+        } else {
+            stdexec::set_value(std::move(self->m_receiver), Prep::value(t_result));
+        }
+    }
+
+    IoUringContext* m_context;
+    Prep m_prep;
+    Receiver m_receiver;
+    std::optional<StopCallback> m_stop_callback;
+    int32_t m_result{0};
+};
+}  // namespace details
+
+// Single-shot operation that completes on the reactor thread when its CQE is reaped
+template <typename Prep>
+class IoUringContext::IoSender
+{
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(typename Prep::ValueType),
+                                                                 stdexec::set_error_t(std::exception_ptr),
+                                                                 stdexec::set_stopped_t()>;
+
+    IoSender(IoUringContext* t_context, Prep t_prep) noexcept : m_context(t_context), m_prep(std::move(t_prep)) {}
+
+    template <stdexec::receiver Receiver>
+    friend auto tag_invoke(stdexec::connect_t /*unused*/, IoSender&& t_self, Receiver t_receiver)
+    {
+        return details::IoOperation<Prep, Receiver>{t_self.m_context, std::move(t_self.m_prep), std::move(t_receiver)};
+    }
+
+private:
+    IoUringContext* m_context;
+    Prep m_prep;
+};
+
+namespace details
+{
+template <typename Receiver>
+class TimerOperation : public TimerOperationBase
+{
+public:
+    TimerOperation(IoUringContext* t_context, IoUringContext::Clock::time_point t_deadline, Receiver t_receiver)
+        : m_context(t_context),
+          m_deadline(t_deadline),
+          m_receiver(std::move(t_receiver))
+    {
+        fire = &TimerOperation::on_fire;
+    }
+
+    TimerOperation(const TimerOperation&) = delete;
+    TimerOperation(TimerOperation&&) = delete;
+    TimerOperation& operator=(const TimerOperation&) = delete;
+    TimerOperation& operator=(TimerOperation&&) = delete;
+
+    friend void tag_invoke(stdexec::start_t /*unused*/, TimerOperation& t_self) noexcept
+    {
+        t_self.start();
+    }
+
+private:
+    using StopToken = stdexec::stop_token_of_t<stdexec::env_of_t<Receiver>>;
+
+    struct OnStopRequested
+    {
+        TimerOperation* self;
+
+        auto operator()() const noexcept -> void
+        {
+            self->request_cancel();
+        }
+    };
+
+    using StopCallback = stdexec::stop_callback_for_t<StopToken, OnStopRequested>;
+
+    auto start() noexcept -> void
+    {
+        auto token = stdexec::get_stop_token(stdexec::get_env(m_receiver));
+        if (token.stop_requested() || m_context->is_stopped()) {
+            stdexec::set_stopped(std::move(m_receiver));
+            return;
+        }
+
+        // Registered first: once scheduled, the timer may fire and the operation be gone at any
+        // time. A stop that lands before the scheduling makes it return 0 below.
+        if constexpr (!stdexec::unstoppable_token<StopToken>) {
+            m_stop_callback.emplace(token, OnStopRequested{this});
+        }
+
+        if (m_context->add_timer_operation(this, m_deadline) == 0) {
+            m_stop_callback.reset();
+            stdexec::set_stopped(std::move(m_receiver));
+        }
+    }
+
+    // Only completes here when the timer was still in the wheel; otherwise on_fire() is on its way,
+    // or start() has not scheduled it yet and completes instead
+    auto request_cancel() noexcept -> void
+    {
+        if (m_context->cancel_timer_operation(this)) {
+            m_stop_callback.reset();
+            stdexec::set_stopped(std::move(m_receiver));
+        }
+    }
+
+    static auto on_fire(TimerNode* t_node, uint64_t /*unused*/, bool t_expired) noexcept -> void
+    {
+        auto* self = static_cast<TimerOperation*>(t_node);
+        self->m_stop_callback.reset();
+
+        if (t_expired) {
+            stdexec::set_value(std::move(self->m_receiver));
+        } else {
+            stdexec::set_stopped(std::move(self->m_receiver));
+        }
+    }
+
+    IoUringContext* m_context;
+    IoUringContext::Clock::time_point m_deadline;
+    Receiver m_receiver;
+    std::optional<StopCallback> m_stop_callback;
+};
+}  // namespace details
+
+// One timer in the context's wheel; nothing is submitted to the ring for it
+class IoUringContext::TimerSender
+{
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures =
+        stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_stopped_t()>;
+
+    TimerSender(IoUringContext* t_context, Clock::time_point t_deadline) noexcept
+        : m_context(t_context),
+          m_deadline(t_deadline)
+    {}
+
+    template <stdexec::receiver Receiver>
+    friend auto tag_invoke(stdexec::connect_t /*unused*/, TimerSender&& t_self, Receiver t_receiver)
+    {
+        return details::TimerOperation<Receiver>{t_self.m_context, t_self.m_deadline, std::move(t_receiver)};
+    }
+
+private:
+    IoUringContext* m_context;
+    Clock::time_point m_deadline;
+};
+
+struct IoUringContext::AcceptPrep
+{
+    using ValueType = int32_t;
+    static constexpr auto* NAME = "accept";
+
+    int32_t fd;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_accept(t_sqe, fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return t_result;
+    }
+};
+
+struct IoUringContext::ReceivePrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "recv";
+
+    FileHandle file;
+    std::span<std::byte> buffer;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_recv(t_sqe, file.fd, buffer.data(), buffer.size(), 0);
+        details::prep_file(t_sqe, file);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+struct IoUringContext::SendPrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "send";
+
+    FileHandle file;
+    std::span<const std::byte> buffer;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_send(t_sqe, file.fd, buffer.data(), buffer.size(), MSG_NOSIGNAL);
+        details::prep_file(t_sqe, file);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+// MSG_WAITALL makes the kernel finish a short stream write itself instead of completing early
+struct IoUringContext::SendVectorsPrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "sendmsg";
+
+    FileHandle file;
+    std::span<const iovec> vectors;
+    msghdr message{};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        message.msg_iov = const_cast<iovec*>(vectors.data());
+        message.msg_iovlen = vectors.size();
+
+        io_uring_prep_sendmsg(t_sqe, file.fd, &message, MSG_NOSIGNAL | MSG_WAITALL);
+        details::prep_file(t_sqe, file);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+struct IoUringContext::SendZeroCopyPrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "sendmsg_zc";
+    static constexpr bool NOTIFIES = true;
+
+    FileHandle file;
+    std::span<const iovec> vectors;
+    msghdr message{};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        message.msg_iov = const_cast<iovec*>(vectors.data());
+        message.msg_iovlen = vectors.size();
+
+        io_uring_prep_sendmsg_zc(t_sqe, file.fd, &message, MSG_NOSIGNAL | MSG_WAITALL);
+        details::prep_file(t_sqe, file);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+// msghdr and iovec live inside the operation state, so they stay valid until the CQE arrives
+struct IoUringContext::RecvFromPrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "recvmsg";
+
+    int32_t fd;
+    std::span<std::byte> buffer;
+    sockaddr_in* address;
+    msghdr message{};
+    iovec vector{};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        vector.iov_base = buffer.data();
+        vector.iov_len = buffer.size();
+
+        message.msg_name = address;
+        message.msg_namelen = sizeof(sockaddr_in);
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1;
+
+        io_uring_prep_recvmsg(t_sqe, fd, &message, 0);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+struct IoUringContext::SendToPrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "sendmsg";
+
+    int32_t fd;
+    std::span<const std::byte> buffer;
+    sockaddr_in address;
+    msghdr message{};
+    iovec vector{};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        vector.iov_base = const_cast<std::byte*>(buffer.data());
+        vector.iov_len = buffer.size();
+
+        message.msg_name = &address;
+        message.msg_namelen = sizeof(address);
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1;
+
+        io_uring_prep_sendmsg(t_sqe, fd, &message, 0);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+struct IoUringContext::PollPrep
+{
+    using ValueType = uint32_t;
+    static constexpr auto* NAME = "poll";
+
+    FileHandle file;
+    uint32_t events;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_poll_add(t_sqe, file.fd, events);
+        details::prep_file(t_sqe, file);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+// A non-blocking socket with a full send buffer fails with EAGAIN; splice is not retried on readiness
+struct IoUringContext::SplicePrep
+{
+    using ValueType = std::size_t;
+    static constexpr auto* NAME = "splice";
+
+    FileHandle in;
+    int64_t in_offset;
+    FileHandle out;
+    int64_t out_offset;
+    uint32_t length;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        // IOSQE_FIXED_FILE only covers the output; a registered input is flagged separately
+        io_uring_prep_splice(t_sqe, in.fd, in_offset, out.fd, out_offset, length,
+                             SPLICE_F_MOVE | (in.fixed ? SPLICE_F_FD_IN_FIXED : 0));
+        details::prep_file(t_sqe, out);
+    }
+
+    static auto value(int32_t t_result) noexcept -> ValueType
+    {
+        return static_cast<ValueType>(t_result);
+    }
+};
+
+inline auto IoUringContext::accept(int32_t t_listen_fd) -> IoSender<AcceptPrep>
+{
+    return {this, AcceptPrep{.fd = t_listen_fd}};
+}
+
+inline auto IoUringContext::receive(FileHandle t_file, std::span<std::byte> t_buffer) -> IoSender<ReceivePrep>
+{
+    return {this, ReceivePrep{.file = t_file, .buffer = t_buffer}};
+}
+
+inline auto IoUringContext::send(FileHandle t_file, std::span<const std::byte> t_buffer) -> IoSender<SendPrep>
+{
+    return {this, SendPrep{.file = t_file, .buffer = t_buffer}};
+}
+
+inline auto IoUringContext::send(FileHandle t_file, std::span<const iovec> t_vectors) -> IoSender<SendVectorsPrep>
+{
+    return {this, SendVectorsPrep{.file = t_file, .vectors = t_vectors}};
+}
+
+inline auto IoUringContext::send_zero_copy(FileHandle t_file, std::span<const iovec> t_vectors)
+    -> IoSender<SendZeroCopyPrep>
+{
+    return {this, SendZeroCopyPrep{.file = t_file, .vectors = t_vectors}};
+}
+
+inline auto IoUringContext::recvfrom(int32_t t_fd, std::span<std::byte> t_buffer, sockaddr_in& t_addr)
+    -> IoSender<RecvFromPrep>
+{
+    return {this, RecvFromPrep{.fd = t_fd, .buffer = t_buffer, .address = &t_addr}};
+}
+
+inline auto IoUringContext::sendto(int32_t t_fd, std::span<const std::byte> t_buffer, const sockaddr_in& t_addr)
+    -> IoSender<SendToPrep>
+{
+    return {this, SendToPrep{.fd = t_fd, .buffer = t_buffer, .address = t_addr}};
+}
+
+inline auto IoUringContext::poll(FileHandle t_file, uint32_t t_events) -> IoSender<PollPrep>
+{
+    return {this, PollPrep{.file = t_file, .events = t_events}};
+}
+
+inline auto IoUringContext::splice(FileHandle t_in, int64_t t_in_offset, FileHandle t_out, int64_t t_out_offset,
+                                   uint32_t t_length) -> IoSender<SplicePrep>
+{
+    return {this, SplicePrep{.in = t_in, .in_offset = t_in_offset, .out = t_out, .out_offset = t_out_offset,
+                             .length = t_length}};
+}
+
+inline auto IoUringContext::schedule_at(Clock::time_point t_deadline) -> TimerSender
+{
+    return {this, t_deadline};
+}
+
+inline auto IoUringContext::schedule_after(Clock::duration t_delay) -> TimerSender
+{
+    return {this, Clock::now() + t_delay};
+}
+
+// Long-lived operation that produces one CQE per event until it is cancelled or the kernel drops it.
+// The handler runs on the reactor thread as handler(result, cqe_flags); once a CQE arrives without
+// IORING_CQE_F_MORE the operation is disarmed and may be armed again. The owner keeps the object
+// alive until that final CQE has been delivered.
+template <typename Prep, typename Handler>
+class MultishotOperation : public details::IoOperationBase
+{
+public:
+    MultishotOperation(IoUringContext& t_context, Prep t_prep, Handler t_handler)
+        : m_context(t_context),
+          m_prep(std::move(t_prep)),
+          m_handler(std::move(t_handler))
+    {
+        complete = &MultishotOperation::on_complete;
+    }
+
+    MultishotOperation(const MultishotOperation&) = delete;
+    MultishotOperation(MultishotOperation&&) = delete;
+    MultishotOperation& operator=(const MultishotOperation&) = delete;
+    MultishotOperation& operator=(MultishotOperation&&) = delete;
+
+    ~MultishotOperation() = default;
+
+    // Returns 0 or an errno value (ECANCELED once the context is stopping, or when cancel() got
+    // in before the SQE was submitted)
+    auto arm() -> int
+    {
+        // Only an operation seen armed is cancelled, so nothing meant for this arming is cleared
+        m_context.reset_operation(this);
+        m_armed.store(true, std::memory_order_release);
+
+        const auto result = m_context.submit_operation(this, [this](io_uring_sqe* t_sqe) { m_prep.prepare(t_sqe); });
+        if (result != 0) {
+            m_armed.store(false, std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    auto cancel() -> void
+    {
+        if (is_armed()) {
+            m_context.cancel_operation(this);
+        }
+    }
+
+    [[nodiscard]] auto is_armed() const noexcept -> bool
+    {
+        return m_armed.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto prep() noexcept -> Prep&
+    {
+        return m_prep;
+    }
+
+private:
+    static auto on_complete(IoOperationBase* t_base, int32_t t_result, uint32_t t_flags) noexcept -> void
+    {
+        auto* self = static_cast<MultishotOperation*>(t_base);
+
+        if (!has_more(t_flags)) {
+            self->m_armed.store(false, std::memory_order_release);
+            self->m_context.operation_finished();
+        }
+
+        self->m_handler(t_result, t_flags);
+    }
+
+    IoUringContext& m_context;
+    Prep m_prep;
+    Handler m_handler;
+    std::atomic<bool> m_armed{false};
+};
+
+// Multishot accept; with t_direct the kernel installs each socket into a free slot of the registered
+// file table and the CQE result is the slot index instead of a descriptor
+struct MultishotAcceptPrep
+{
+    int32_t fd;
+    bool direct{false};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        if (direct) {
+            io_uring_prep_multishot_accept_direct(t_sqe, fd, nullptr, nullptr, 0);
+        } else {
+            io_uring_prep_multishot_accept(t_sqe, fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        }
+    }
+};
+
+template <typename Handler>
+using MultishotAccept = MultishotOperation<MultishotAcceptPrep, Handler>;
+
+// Multishot receive into buffers the kernel selects from a BufferRing group. Each CQE carries
+// the selected buffer id in its flags (see BufferRing::take); -ENOBUFS ends the operation
+// when the group has run dry.
+struct MultishotReceivePrep
+{
+    FileHandle file;
+    uint16_t buffer_group;
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_recv_multishot(t_sqe, file.fd, nullptr, 0, 0);
+        details::prep_file(t_sqe, file);
+        t_sqe->flags |= IOSQE_BUFFER_SELECT;
+        t_sqe->buf_group = buffer_group;
+    }
+};
+
+template <typename Handler>
+using MultishotReceive = MultishotOperation<MultishotReceivePrep, Handler>;
+// Multishot recvmsg for datagram sockets. Every CQE fills one provided buffer laid out as
+// io_uring_recvmsg_out, source address, control data and payload; see parse_received_message().
+// `header` only carries the name and control lengths the kernel reserves in each buffer.
+struct MultishotRecvMsgPrep
+{
+    int32_t fd;
+    uint16_t buffer_group;
+    msghdr header{.msg_namelen = sizeof(sockaddr_in6)};
+
+    auto prepare(io_uring_sqe* t_sqe) -> void
+    {
+        io_uring_prep_recvmsg_multishot(t_sqe, fd, &header, 0);
+        t_sqe->flags |= IOSQE_BUFFER_SELECT;
+        t_sqe->buf_group = buffer_group;
+    }
+
+    // Space a provided buffer needs on top of the payload
+    [[nodiscard]] auto overhead() const noexcept -> std::size_t
+    {
+        return sizeof(io_uring_recvmsg_out) + header.msg_namelen + header.msg_controllen;
+    }
+};
+
+template <typename Handler>
+using MultishotRecvMsg = MultishotOperation<MultishotRecvMsgPrep, Handler>;
+
+struct ReceivedMessage
+{
+    const sockaddr* name;
+    socklen_t name_length;
+    std::span<const std::byte> control;
+    std::span<std::byte> payload;
+    bool truncated;
+};
+
+// Splits a buffer filled by a multishot recvmsg; nullopt when the buffer is too short to be valid
+[[nodiscard]] inline auto parse_received_message(std::span<std::byte> t_buffer, msghdr& t_header) noexcept
+    -> std::optional<ReceivedMessage>
+{
+    const auto length = static_cast<int>(t_buffer.size());
+    auto* out = io_uring_recvmsg_validate(t_buffer.data(), length, &t_header);
+    if (out == nullptr) {
+        return std::nullopt;
+    }
+
+    auto* control = reinterpret_cast<std::byte*>(out + 1) + t_header.msg_namelen;
+    auto* payload = static_cast<std::byte*>(io_uring_recvmsg_payload(out, &t_header));
+
+    return ReceivedMessage{
+        .name = static_cast<const sockaddr*>(io_uring_recvmsg_name(out)),
+        .name_length = std::min<socklen_t>(out->namelen, t_header.msg_namelen),
+        .control = {control, std::min<std::size_t>(out->controllen, t_header.msg_controllen)},
+        .payload = {payload, io_uring_recvmsg_payload_length(out, length, &t_header)},
+        .truncated = (out->flags & MSG_TRUNC) != 0,
+    };
+}
+}  // namespace zephyr::io
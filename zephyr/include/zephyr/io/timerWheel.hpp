@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace zephyr::io
+{
+// Intrusive timer entry. Whoever schedules it keeps it alive and in place until it has expired or
+// been cancelled; scheduling never allocates.
+struct TimerNode
+{
+    // Called by the owner of the wheel with the generation the node expired with, and false when
+    // the timer was dropped without expiring (the context is stopping)
+    using FireFn = void (*)(TimerNode*, uint64_t, bool) noexcept;
+
+    FireFn fire{nullptr};
+
+    // Wheel bookkeeping; next is nullptr while the node is not scheduled
+    TimerNode* prev{nullptr};
+    TimerNode* next{nullptr};
+    uint64_t expiry{0};
+    uint64_t generation{0};
+    uint32_t slot{0};
+
+    [[nodiscard]] auto is_scheduled() const noexcept -> bool { return next != nullptr; }
+};
+
+struct ExpiredTimer
+{
+    TimerNode* node;
+    uint64_t generation;
+};
+
+// Hierarchical timing wheel: a wheel of 256 one-tick slots and three coarser wheels of 64 slots
+// above it, each slot of which covers a whole turn of the wheel below. A timer goes into the
+// slot its deadline falls in on the finest wheel that reaches it, and is moved down a level each
+// time the wheel below wraps, so insert and cancel are O(1) whatever the number of timers.
+// Deadlines are rounded up to whole ticks and never fire early. Not synchronized.
+class TimerWheel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t LEVELS = 4;
+
+    explicit TimerWheel(Clock::duration t_tick = std::chrono::milliseconds{1}, Clock::time_point t_start = Clock::now());
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    // Schedules t_node, moving it when it is already scheduled; returns its new generation. A
+    // deadline that has already passed expires on the next tick.
+    auto schedule(TimerNode& t_node, Clock::time_point t_deadline) -> uint64_t;
+
+    // False when t_node was not scheduled, because it expired or was never scheduled
+    auto cancel(TimerNode& t_node) noexcept -> bool;
+
+    // Unlinks every timer due by t_now and appends it to t_expired, earliest tick first
+    auto advance(Clock::time_point t_now, std::vector<ExpiredTimer>& t_expired) -> void;
+
+    // Unlinks every timer and appends it to t_expired
+    auto clear(std::vector<ExpiredTimer>& t_expired) -> void;
+
+    // When advance() next has something to do: the earliest expiry on the finest wheel, or the
+    // earliest time a coarser wheel hands timers down. nullopt when the wheel is empty.
+    [[nodiscard]] auto next_wakeup() const noexcept -> std::optional<Clock::time_point>;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+    [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+    [[nodiscard]] auto tick() const noexcept -> Clock::duration { return m_tick; }
+
+private:
+    static constexpr uint32_t FINE_BITS = 8;
+    static constexpr uint32_t COARSE_BITS = 6;
+    static constexpr uint32_t FINE_SLOTS = 1U << FINE_BITS;
+    static constexpr uint32_t COARSE_SLOTS = 1U << COARSE_BITS;
+    static constexpr uint32_t SLOTS = FINE_SLOTS + (LEVELS - 1) * COARSE_SLOTS;
+    // Ticks the wheels reach together; later deadlines wait in the last slot and are placed again
+    static constexpr uint64_t RANGE = uint64_t{1} << (FINE_BITS + (LEVELS - 1) * COARSE_BITS);
+
+    static constexpr auto shift(uint32_t t_level) noexcept -> uint32_t
+    {
+        return t_level == 0 ? 0 : FINE_BITS + (t_level - 1) * COARSE_BITS;
+    }
+
+    static constexpr auto first_slot(uint32_t t_level) noexcept -> uint32_t
+    {
+        return t_level == 0 ? 0 : FINE_SLOTS + (t_level - 1) * COARSE_SLOTS;
+    }
+
+    static constexpr auto slot_count(uint32_t t_level) noexcept -> uint32_t
+    {
+        return t_level == 0 ? FINE_SLOTS : COARSE_SLOTS;
+    }
+
+    auto to_tick(Clock::time_point t_time, bool t_round_up) const noexcept -> uint64_t;
+    auto link(TimerNode& t_node) noexcept -> void;
+    auto unlink(TimerNode& t_node) noexcept -> void;
+    // Moves the timers of a coarse slot down to the wheels below
+    auto cascade(uint32_t t_level) noexcept -> void;
+    auto take_slot(uint32_t t_slot, std::vector<ExpiredTimer>& t_expired) -> void;
+    // Distance from slot t_from of t_level to the first occupied slot, wrapping; npos when none
+    auto next_occupied(uint32_t t_level, uint32_t t_from) const noexcept -> uint32_t;
+
+    static constexpr uint32_t npos = ~uint32_t{0};
+
+    Clock::duration m_tick;
+    Clock::time_point m_start;
+    // Every tick up to and including this one has been processed
+    uint64_t m_current{0};
+    std::size_t m_size{0};
+    // Circular lists headed by sentinels, one per slot, and a bit per non-empty slot
+    std::array<TimerNode, SLOTS> m_slots{};
+    std::array<uint64_t, SLOTS / 64> m_occupied{};
+};
+}  // namespace zephyr::io
@@ -3,12 +3,41 @@
 #include "zephyr/core/logger.hpp"
 #include "zephyr/network/endpoint.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <sys/socket.h>
+
 namespace zephyr::network
 {
+struct UdpSocketOptions
+{
+    // UDP_GRO: the kernel may coalesce same-flow datagrams into one receive, see groSegmentSize()
+    bool gro{false};
+    // UDP_SEGMENT: one send may carry several equally sized datagrams, see setGsoSegment()
+    bool gso{false};
+    // Path MTU towards the peers. The kernel refuses a whole GSO send with EINVAL when its segments
+    // do not fit, so only datagrams up to maxGsoSegment() are merged.
+    uint16_t mtu{1500};
+    // SO_RCVBUF / SO_SNDBUF, 0 keeps the system default
+    int receiveBufferSize{0};
+    int sendBufferSize{0};
+    // SO_REUSEPORT: several sockets bound to the same endpoint share its traffic
+    bool reusePort{false};
+};
+
 class UdpSocket
 {
 public:
-    explicit UdpSocket(UdpEndpoint t_endpoint) noexcept;
+    // Datagrams a single GSO send may carry and the payload they may add up to
+    static constexpr std::size_t MAX_GSO_SEGMENTS = 64;
+    static constexpr std::size_t MAX_GSO_BYTES = 65507;
+    // Control space needed to receive the GRO segment size / to send a GSO segment size
+    static constexpr std::size_t GRO_CONTROL_SIZE = CMSG_SPACE(sizeof(int));
+    static constexpr std::size_t GSO_CONTROL_SIZE = CMSG_SPACE(sizeof(uint16_t));
+
+    explicit UdpSocket(UdpEndpoint t_endpoint, UdpSocketOptions t_options = {}) noexcept;
     UdpSocket(const UdpSocket&) = delete;
     UdpSocket& operator=(const UdpSocket&) = delete;
     UdpSocket(UdpSocket&& t_other) noexcept;
@@ -18,8 +47,55 @@ public:
     auto bind(core::Logger::LoggerPtr& t_logger) -> void;
     auto close() noexcept -> void;
 
+    // Non-blocking batch I/O (recvmmsg/sendmmsg); return the number of messages or -1 with errno set
+    auto receiveMessages(std::span<mmsghdr> t_messages) noexcept -> int;
+    auto sendMessages(std::span<mmsghdr> t_messages) noexcept -> int;
+
+    // Options the kernel refused are switched off by bind()
+    [[nodiscard]] auto groEnabled() const noexcept -> bool
+    {
+        return m_options.gro;
+    }
+
+    [[nodiscard]] auto gsoEnabled() const noexcept -> bool
+    {
+        return m_options.gso;
+    }
+
+    // Largest payload that still fits the MTU once the IP and UDP headers are added
+    [[nodiscard]] auto maxGsoSegment() const noexcept -> std::size_t
+    {
+        const std::size_t headers = (m_endpoint.isV6() ? 40 : 20) + 8;
+        return m_options.mtu > headers ? m_options.mtu - headers : 0;
+    }
+
+    // Segment size of a GRO aggregate taken from received control data, 0 for a plain datagram
+    [[nodiscard]] static auto groSegmentSize(std::span<const std::byte> t_control) noexcept -> std::size_t;
+
+    // Fills t_control (GSO_CONTROL_SIZE bytes) and attaches it to t_message
+    static auto setGsoSegment(msghdr& t_message, std::span<std::byte> t_control, uint16_t t_segmentSize) noexcept
+        -> void;
+
+    // Attaches a classic BPF program to this socket's SO_REUSEPORT group that picks socket
+    // (cpu - t_firstCpu) % t_groupSize, i.e. the socket bound by the shard pinned to the CPU
+    // that received the packet. Throws std::system_error when the kernel refuses it.
+    auto steerByCpu(uint32_t t_groupSize, uint32_t t_firstCpu = 0) -> void;
+
+    [[nodiscard]] auto nativeHandle() const noexcept -> int
+    {
+        return m_socket;
+    }
+
+    [[nodiscard]] auto endpoint() const noexcept -> const UdpEndpoint&
+    {
+        return m_endpoint;
+    }
+
 private:
+    auto applyOptions(core::Logger::LoggerPtr& t_logger) -> void;
+
     UdpEndpoint m_endpoint;
+    UdpSocketOptions m_options;
     int m_socket;
 };
 }  // namespace zephyr::network
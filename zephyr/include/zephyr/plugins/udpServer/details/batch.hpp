@@ -0,0 +1,59 @@
+#pragma once
+
+#include "zephyr/io/bufferRing.hpp"
+#include "zephyr/network/udpSocket.hpp"
+#include "zephyr/plugins/udpServer/details/protocol.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace zephyr::plugins::udp::details
+{
+// Packets received during one reactor wakeup together with the provided buffers backing them
+struct ReceiveBatch
+{
+    std::vector<PacketView> packets;
+    std::vector<io::ProvidedBuffer> buffers;
+
+    auto clear() noexcept -> void
+    {
+        packets.clear();
+        buffers.clear();
+    }
+};
+
+// Appends t_payload as one packet, or split into its segments when it is a GRO aggregate
+auto appendPackets(std::vector<PacketView>& t_packets, std::span<char> t_payload, const sockaddr* t_source,
+                   socklen_t t_sourceLength, std::size_t t_segmentSize) -> void;
+
+// recvmmsg fallback for kernels without provided buffer rings; owns storage for one full batch
+class MessageBatch
+{
+public:
+    MessageBatch(uint32_t t_batchSize, uint32_t t_maxPacketSize, std::size_t t_controlSize);
+
+    // Reads whatever is queued on the socket, up to one batch; the views stay valid until the next call
+    auto receive(network::UdpSocket& t_socket) -> std::span<PacketView>;
+
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t
+    {
+        return m_headers.size();
+    }
+
+private:
+    uint32_t m_maxPacketSize;
+    std::size_t m_controlSize;
+    std::unique_ptr<char[]> m_storage;
+    std::unique_ptr<cmsghdr[]> m_control;
+    std::vector<sockaddr_storage> m_addresses;
+    std::vector<iovec> m_vectors;
+    std::vector<mmsghdr> m_headers;
+    std::vector<PacketView> m_packets;
+};
+}  // namespace zephyr::plugins::udp::details
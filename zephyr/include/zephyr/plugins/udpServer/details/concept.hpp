@@ -1,6 +1,7 @@
 #pragma once
 
 #include "zephyr/plugins/udpServer/details/protocol.hpp"
+#include "zephyr/plugins/udpServer/details/responseSink.hpp"
 
 #include <concepts>
 #include <span>
@@ -13,6 +14,28 @@ concept HasOnMessage = requires(C t_class) {
     { t_class.onMessage(std::declval<std::span<char>>()) } -> std::same_as<UdpProtocol::OutputType>;
 };
 
+// Batched variant: one call per receive batch, replies written into the sink's slots
 template <class C>
-concept ControllerConcept = HasOnMessage<C>;
+concept HasOnMessages = requires(C t_class, std::span<PacketView> t_packets, ResponseSink& t_sink) {
+    { t_class.onMessages(t_packets, t_sink) } -> std::same_as<void>;
+};
+
+template <class C>
+concept ControllerConcept = HasOnMessage<C> || HasOnMessages<C>;
+
+// Hands one receive batch to t_controller: in a single call when it takes batches, otherwise packet
+// by packet with every reply queued in t_sink. Flushing the sink is left to the caller.
+template <ControllerConcept Controller>
+auto deliverPackets(Controller& t_controller, std::span<PacketView> t_packets, ResponseSink& t_sink) -> void
+{
+    if constexpr (HasOnMessages<Controller>) {
+        t_controller.onMessages(t_packets, t_sink);
+    } else {
+        for (const auto& packet : t_packets) {
+            if (auto reply = t_controller.onMessage(packet.payload)) {
+                t_sink.send(packet, std::span{reinterpret_cast<const char*>(reply->data()), reply->size()});
+            }
+        }
+    }
+}
 }  // namespace zephyr::plugins::udp
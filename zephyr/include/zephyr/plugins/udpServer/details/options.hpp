@@ -0,0 +1,35 @@
+#pragma once
+
+#include "zephyr/network/udpSocket.hpp"
+
+#include <cstdint>
+
+namespace zephyr::plugins::udp
+{
+struct UdpServerOptions
+{
+    // Receive buffers handed to the kernel (multishot recvmsg); the count has to be a power of two
+    uint32_t bufferCount{4096};
+    // Largest payload accepted; longer datagrams are dropped as truncated
+    uint32_t maxPacketSize{2048};
+    // Size of each ResponseSink slot; larger replies are sent on their own
+    uint32_t maxReplySize{2048};
+    // Packets read per recvmmsg call when the kernel has no provided buffer rings
+    uint32_t batchSize{64};
+    uint32_t ringEntries{1024};
+    // GRO and GSO are switched on here; with GRO every receive buffer has room for a full
+    // 64 KiB aggregate, so fewer of them are used
+    network::UdpSocketOptions socket{};
+    uint32_t groBufferCount{256};
+
+    // Sharded mode (shards > 1): every shard binds its own SO_REUSEPORT socket and owns a ring
+    // and a reactor thread, pinned to firstCpu + index when pinThreads is set. Each shard gets a
+    // copy of the controller and runs it on its reactor thread instead of the strand.
+    uint32_t shards{1};
+    bool pinThreads{true};
+    uint32_t firstCpu{0};
+    // Classic BPF steering: a packet goes to the shard pinned to the CPU that received it,
+    // so with RSS every flow stays on one core. Otherwise the kernel hashes the 4-tuple.
+    bool steerByCpu{false};
+};
+}  // namespace zephyr::plugins::udp
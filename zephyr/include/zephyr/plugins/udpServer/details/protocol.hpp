@@ -1,31 +1,39 @@
 #pragma once
 
 // #include "zephyr/common/resultSender.hpp"
+#include "zephyr/network/endpoint.hpp"
 
 #include <cstdint>
 #include <optional>
-#include <string>
+#include <span>
 #include <vector>
 
 #include <netinet/in.h>
+#include <sys/socket.h>
 
 namespace zephyr::plugins::udp
 {
-struct UdpProtocol
+// One received datagram. Both the payload and the source address point into the receive buffer,
+// which is only valid for the duration of the controller call.
+struct PacketView
 {
-    struct InputType
+    std::span<char> payload;
+    const sockaddr* source;
+    socklen_t sourceLength;
+
+    [[nodiscard]] auto sourceEndpoint() const -> network::UdpEndpoint
     {
-        std::string sourceIp{};
-        uint16_t sourcePort;
-        uint16_t destPort;
-        sockaddr_in clientAddr;
-        std::vector<uint8_t> data{};
-    };
+        return network::UdpEndpoint{source, sourceLength};
+    }
+};
 
+struct UdpProtocol
+{
+    using InputType = PacketView;
     using OutputType = std::optional<std::vector<uint8_t>>;
     // using ResultSenderType = common::ResultSender<OutputType>;
 
     static constexpr auto SOCKET_TYPE = SOCK_DGRAM;
     static constexpr auto* NAME = "UDP";
 };
-}  // namespace zephyr::plugins::udp
\ No newline at end of file
+}  // namespace zephyr::plugins::udp
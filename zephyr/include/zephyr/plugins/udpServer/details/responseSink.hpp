@@ -0,0 +1,82 @@
+#pragma once
+
+#include "zephyr/network/udpSocket.hpp"
+#include "zephyr/plugins/udpServer/details/protocol.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace zephyr::plugins::udp
+{
+// Reply slots for one receive batch. Storage is allocated once, so a controller writes its
+// replies in place instead of returning a vector per packet. Full slots are flushed with a
+// single sendmmsg; on a socket with GSO enabled, consecutive replies to the same destination
+// of the same size, each within the socket's MTU, go out as one UDP_SEGMENT message.
+// A reply the socket refuses is dropped on its own; the rest of the batch is still sent.
+class ResponseSink
+{
+public:
+    ResponseSink(network::UdpSocket& t_socket, std::size_t t_slots, std::size_t t_slotSize);
+
+    ResponseSink(const ResponseSink&) = delete;
+    ResponseSink& operator=(const ResponseSink&) = delete;
+
+    // Slot of slotSize() bytes for a reply to t_packet's source; finish it with commit()
+    auto prepare(const PacketView& t_packet) -> std::span<char>;
+    auto commit(std::size_t t_length) -> void;
+
+    // Copies t_payload into a slot; replies larger than a slot are sent on their own
+    auto send(const PacketView& t_packet, std::span<const char> t_payload) -> void;
+
+    // Sends every committed reply
+    auto flush() -> void;
+
+    [[nodiscard]] auto slotSize() const noexcept -> std::size_t
+    {
+        return m_slotSize;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return m_size;
+    }
+
+    // Replies the socket refused (full send buffer, unreachable peer, ...) since the last call
+    auto takeDropped() noexcept -> std::size_t
+    {
+        return std::exchange(m_dropped, 0);
+    }
+
+    // How many of t_messages (one iovec each), from the first, a single UDP_SEGMENT send may carry
+    // with segments of at most t_maxSegment bytes; 1 when the first goes out on its own
+    [[nodiscard]] static auto segmentRun(std::span<const mmsghdr> t_messages, std::size_t t_maxSegment) noexcept
+        -> std::size_t;
+
+private:
+    struct alignas(cmsghdr) GsoControl
+    {
+        std::byte data[network::UdpSocket::GSO_CONTROL_SIZE];
+    };
+
+    auto flushSegmented(std::size_t t_count) -> void;
+    static auto sameDestination(const mmsghdr& t_first, const mmsghdr& t_other) noexcept -> bool;
+    auto sendMessages(std::span<mmsghdr> t_messages) -> void;
+
+    network::UdpSocket& m_socket;
+    std::size_t m_slotSize;
+    std::unique_ptr<char[]> m_storage;
+    std::vector<sockaddr_storage> m_addresses;
+    std::vector<iovec> m_vectors;
+    std::vector<mmsghdr> m_headers;
+    std::vector<mmsghdr> m_gsoHeaders;
+    std::vector<GsoControl> m_gsoControl;
+    std::size_t m_size{0};
+    std::size_t m_dropped{0};
+};
+}  // namespace zephyr::plugins::udp
@@ -1,47 +1,105 @@
 #pragma once
 
 #include "zephyr/core/logger.hpp"
+#include "zephyr/core/threadAffinity.hpp"
 #include "zephyr/execution/strandScheduler.hpp"
+#include "zephyr/io/bufferRing.hpp"
+#include "zephyr/io/ioUringContext.hpp"
 #include "zephyr/network/endpoint.hpp"
 #include "zephyr/network/udpSocket.hpp"
+#include "zephyr/plugins/udpServer/details/batch.hpp"
 #include "zephyr/plugins/udpServer/details/concept.hpp"
+#include "zephyr/plugins/udpServer/details/options.hpp"
 #include "zephyr/plugins/udpServer/details/protocol.hpp"
+#include "zephyr/plugins/udpServer/details/responseSink.hpp"
 
 #include <exec/linux/io_uring_context.hpp>
 #include <exec/static_thread_pool.hpp>
 #include <stdexec/execution.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <optional>
-#include <unistd.h>
+#include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 
-#include <arpa/inet.h>
-#include <netinet/in.h>
-#include <sys/socket.h>
+#include <poll.h>
 
 namespace zephyr::plugins
 {
 template <udp::ControllerConcept Controller, stdexec::scheduler BaseScheduler>
 class UdpServer
 {
+    struct Shard;
+
+    struct ReceiveHandler
+    {
+        UdpServer* server;
+        Shard* shard;
+
+        auto operator()(int32_t t_result, uint32_t t_flags) const noexcept -> void
+        {
+            server->onReceive(*shard, t_result, t_flags);
+        }
+    };
+
+    // One socket with its own ring and reactor thread
+    struct Shard
+    {
+        template <typename ControllerArg>
+        Shard(std::size_t t_index, ControllerArg&& t_controller)
+            : index(t_index),
+              controller(std::forward<ControllerArg>(t_controller))
+        {}
+
+        std::size_t index;
+        Controller controller;
+        std::optional<network::UdpSocket> socket;
+        std::unique_ptr<io::IoUringContext> ioContext;
+        std::unique_ptr<io::BufferRing> buffers;
+        std::optional<io::MultishotRecvMsg<ReceiveHandler>> receiveOp;
+        std::jthread reactor;
+
+        std::mutex spareMutex;
+        std::vector<std::unique_ptr<udp::details::ReceiveBatch>> spareBatches;
+        // Reactor thread only
+        std::unique_ptr<udp::details::ReceiveBatch> batch;
+
+        // Wherever the controller runs (strand, or the reactor thread when sharded)
+        std::optional<udp::ResponseSink> sink;
+        std::optional<udp::details::MessageBatch> fallback;
+    };
+
 public:
     template <typename ControllerArg>
         requires std::constructible_from<Controller, ControllerArg>
-    explicit UdpServer(network::UdpEndpoint t_endpoint, ControllerArg&& t_controller)
+    explicit UdpServer(network::UdpEndpoint t_endpoint, ControllerArg&& t_controller,
+                       udp::UdpServerOptions t_options = {})
         : m_controller(std::forward<ControllerArg>(t_controller)),
-          m_endpoint(t_endpoint)
+          m_endpoint(t_endpoint),
+          m_options(t_options)
     {}
 
     UdpServer(const UdpServer&) = delete;
+
+    // Only valid before init(); the shards are created there
     UdpServer(UdpServer&& t_other) noexcept
         : m_controller(std::move(t_other.m_controller)),
           m_strand(std::move(t_other.m_strand)),
           m_isRunning(t_other.m_isRunning.load()),
           m_logger(std::move(t_other.m_logger)),
           m_endpoint(std::move(t_other.m_endpoint)),
-          m_socket(std::move(t_other.m_socket))
+          m_options(t_other.m_options),
+          m_shards(std::move(t_other.m_shards))
     {
         t_other.m_isRunning.store(false);
     }
@@ -49,115 +107,325 @@ public:
     UdpServer& operator=(const UdpServer&) = delete;
     UdpServer& operator=(UdpServer&&) noexcept = default;
 
-    ~UdpServer() = default;
+    ~UdpServer()
+    {
+        stop();
+    }
 
     auto init(stdexec::scheduler auto t_scheduler) -> void
     {
         m_strand = execution::StrandScheduler<BaseScheduler>(std::move(t_scheduler));
         m_logger = core::Logger::createLogger("UDP");
-        m_socket = network::UdpSocket{m_endpoint};
 
         ZEPHYR_LOG_INFO(m_logger, "Initializing UDP plugin");
 
-        m_socket->bind(m_logger);
+        const auto shardCount = std::max<uint32_t>(m_options.shards, 1);
+        auto socketOptions = m_options.socket;
+        socketOptions.reusePort = socketOptions.reusePort || shardCount > 1;
+
+        // Bind order is the socket's index in the SO_REUSEPORT group, which the steering program relies on
+        m_shards.reserve(shardCount);
+        for (std::size_t index = 0; index < shardCount; ++index) {
+            auto& shard = *m_shards.emplace_back(makeShard(index, shardCount));
+            shard.socket.emplace(m_endpoint, socketOptions);
+            shard.ioContext = std::make_unique<io::IoUringContext>(m_options.ringEntries);
+            shard.socket->bind(m_logger);
+        }
+
+        if (shardCount > 1 && m_options.steerByCpu) {
+            try {
+                m_shards.front()->socket->steerByCpu(shardCount, m_options.firstCpu);
+            } catch (const std::exception& t_exception) {
+                ZEPHYR_LOG_WARN(m_logger, "CPU steering unavailable: {}", t_exception.what());
+            }
+        }
     }
 
     auto start() -> void
     {
-        receiveLoop();
+        m_isRunning.store(true);
+
+        for (auto& shard : m_shards) {
+            startShard(*shard);
+        }
     }
 
     auto stop()
     {
-        m_isRunning.store(false);
-        // m_ioContext->cancel();
-        if (m_socket) {
-            m_socket->close();
+        if (!m_isRunning.exchange(false)) {
+            return;
+        }
+
+        for (auto& shard : m_shards) {
+            if (shard->receiveOp) {
+                shard->receiveOp->cancel();
+            }
+            shard->ioContext->stop();
+        }
+
+        for (auto& shard : m_shards) {
+            if (shard->reactor.joinable()) {
+                shard->reactor.join();
+            }
+        }
+
+        // Batches already handed to the strand still reply through the sinks and sockets, and give
+        // their buffers back to the rings; nothing new is dispatched once the reactors are gone
+        while (m_dispatched.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+
+        for (auto& shard : m_shards) {
+            shard->socket->close();
         }
     }
 
 private:
-    auto receiveLoop() -> void
+    // The last shard takes the controller itself, the others get copies
+    auto makeShard(std::size_t t_index, std::size_t t_count) -> std::unique_ptr<Shard>
+    {
+        if (t_index + 1 == t_count) {
+            return std::make_unique<Shard>(t_index, std::move(m_controller));
+        }
+
+        if constexpr (std::copy_constructible<Controller>) {
+            return std::make_unique<Shard>(t_index, m_controller);
+        } else {
+            throw std::invalid_argument("Sharded UdpServer needs a copyable controller");
+        }
+    }
+
+    [[nodiscard]] auto isSharded() const noexcept -> bool
     {
-        if (m_isRunning.load()) {
+        return m_shards.size() > 1;
+    }
+
+    auto startShard(Shard& t_shard) -> void
+    {
+        const auto replySlots = std::max<std::size_t>(m_options.batchSize, io::IoUringContext::COMPLETION_BATCH_SIZE);
+        t_shard.sink.emplace(*t_shard.socket, replySlots, m_options.maxReplySize);
+        t_shard.batch = takeSpareBatch(t_shard);
+
+        if (!startMultishot(t_shard)) {
+            startFallback(t_shard);
+        }
+
+        // Dedicated reactor; every wakeup hands its packets to the controller as one batch
+        t_shard.reactor = std::jthread([this, &t_shard] {
+            if (isSharded() && m_options.pinThreads) {
+                const auto cpu = m_options.firstCpu + static_cast<uint32_t>(t_shard.index);
+                if (!core::pinCurrentThread(cpu)) {
+                    ZEPHYR_LOG_WARN(m_logger, "Cannot pin shard {} to CPU {}", t_shard.index, cpu);
+                }
+            }
+
+            t_shard.ioContext->run([this, &t_shard] { flushBatch(t_shard); });
+        });
+    }
+
+    // Sharded servers run the controller on the shard's reactor thread so a packet never leaves
+    // its core; a single shard hands the work to the strand and keeps the ring spinning. stop()
+    // waits for the work on the strand, counted until it has completed, failed or been stopped.
+    template <typename Work>
+    auto dispatch(Work&& t_work) -> void
+    {
+        if (isSharded()) {
+            t_work();
             return;
         }
 
-        auto workflow = stdexec::schedule(*m_strand) | stdexec::then([&]() {
-                            ZEPHYR_LOG_INFO(m_logger, "Zyje");
-                            std::this_thread::sleep_for(std::chrono::seconds(2));
-                        })
-                        | stdexec::then([=]() {
-                              if (m_isRunning.load()) {}
-                          });
+        m_dispatched.fetch_add(1, std::memory_order_relaxed);
+        auto done = [this] { m_dispatched.fetch_sub(1, std::memory_order_release); };
+        stdexec::start_detached(stdexec::schedule(*m_strand) | stdexec::then(std::forward<Work>(t_work))
+                                | stdexec::then(done)
+                                | stdexec::upon_error([done](std::exception_ptr /*unused*/) { done(); })
+                                | stdexec::upon_stopped(done));
+    }
 
-        stdexec::start_detached(std::move(workflow));
+    auto startMultishot(Shard& t_shard) -> bool
+    {
+        try {
+            io::MultishotRecvMsgPrep prep{.fd = t_shard.socket->nativeHandle(), .buffer_group = 0};
+            auto bufferCount = m_options.bufferCount;
+            std::size_t payloadSize = m_options.maxPacketSize;
+
+            if (t_shard.socket->groEnabled()) {
+                prep.header.msg_controllen = network::UdpSocket::GRO_CONTROL_SIZE;
+                bufferCount = m_options.groBufferCount;
+                payloadSize = UINT16_MAX;
+            }
+
+            t_shard.buffers = std::make_unique<io::BufferRing>(*t_shard.ioContext, bufferCount,
+                                                               static_cast<uint32_t>(payloadSize + prep.overhead()));
+            prep.buffer_group = t_shard.buffers->group_id();
+            t_shard.receiveOp.emplace(*t_shard.ioContext, prep, ReceiveHandler{this, &t_shard});
+        } catch (const std::exception& t_exception) {
+            ZEPHYR_LOG_WARN(m_logger, "Provided buffers unavailable, using recvmmsg: {}", t_exception.what());
+            t_shard.buffers.reset();
+            return false;
+        }
+
+        armReceive(t_shard);
+        return true;
+    }
+
+    auto armReceive(Shard& t_shard) -> void
+    {
+        if (!m_isRunning.load()) {
+            return;
+        }
+
+        if (const auto result = t_shard.receiveOp->arm(); result != 0 && result != ECANCELED) {
+            ZEPHYR_LOG_ERROR(m_logger, "Cannot arm receive: {}", std::strerror(result));
+        }
+    }
+
+    // Runs on the shard's reactor thread for every datagram; packets are only collected here
+    auto onReceive(Shard& t_shard, int32_t t_result, uint32_t t_flags) -> void
+    {
+        if (t_result >= 0 && (t_flags & IORING_CQE_F_BUFFER) != 0) {
+            auto buffer = t_shard.buffers->take(t_flags, static_cast<std::size_t>(t_result));
+            auto message = io::parse_received_message(buffer.mutable_data(), t_shard.receiveOp->prep().header);
+
+            // Dropped packets give their buffer back right away
+            if (message && !message->truncated) {
+                udp::details::appendPackets(
+                    t_shard.batch->packets, {reinterpret_cast<char*>(message->payload.data()), message->payload.size()},
+                    message->name, message->name_length, network::UdpSocket::groSegmentSize(message->control));
+                t_shard.batch->buffers.push_back(std::move(buffer));
+            }
+        }
+
+        if (io::has_more(t_flags) || !m_isRunning.load()) {
+            return;
+        }
+
+        switch (-t_result) {
+            case ENOBUFS:
+                // The controller holds every buffer; resume once a batch has been processed
+                t_shard.buffers->when_available([this, &t_shard] { armReceive(t_shard); });
+                break;
+            case ECANCELED:
+                break;
+            case EINVAL:
+            case EOPNOTSUPP:
+                ZEPHYR_LOG_WARN(m_logger, "Multishot recvmsg unsupported, using recvmmsg");
+                startFallback(t_shard);
+                break;
+            default:
+                if (t_result < 0) {
+                    ZEPHYR_LOG_ERROR(m_logger, "Receive error: {}", std::strerror(-t_result));
+                }
+                armReceive(t_shard);
+                break;
+        }
+    }
 
-        // auto strandScheduler =
+    auto flushBatch(Shard& t_shard) -> void
+    {
+        if (t_shard.batch->packets.empty()) {
+            return;
+        }
 
-        // auto work = stdexec::schedule(t_scheduler) | stdexec::then([this]() { receive(); })
-        //             | stdexec::let_value([this](auto t_maybePacket) {
-        //                   using Result = std::optional<std::pair<std::vector<uint8_t>, sockaddr_in>>;
-        //                   using Sender = common::ResultSender<Result>;
+        auto batch = std::exchange(t_shard.batch, takeSpareBatch(t_shard));
+        dispatch([this, &t_shard, batch = std::move(batch)]() mutable {
+            processPackets(t_shard, batch->packets);
+            batch->clear();
+            returnSpareBatch(t_shard, std::move(batch));
+        });
+    }
 
-        //                   if (!t_maybePacket) {
-        //                       return Sender{stdexec::just(Result{})};
-        //                   }
+    auto processPackets(Shard& t_shard, std::span<udp::PacketView> t_packets) -> void
+    {
+        udp::deliverPackets(t_shard.controller, t_packets, *t_shard.sink);
 
-        //                   auto [packet, address] = std::move(*t_maybePacket);
-        //                   return Sender()
-        //               });
-        //             | stdexec::then(/*maybe response*/)
-        //             | stdexec::upon_error([this, scheduler = t_scheduler](std::exception_ptr t_exceptionPtr) {
-        //                   try {
-        //                       std::rethrow_exception(t_exceptionPtr)
-        //                   } catch (const std::exception& t_exception) {
-        //                       // Log Error
-        //                   }
+        t_shard.sink->flush();
+        if (const auto dropped = t_shard.sink->takeDropped(); dropped > 0) {
+            ZEPHYR_LOG_WARN(m_logger, "Dropped {} replies, send buffer full", dropped);
+        }
+    }
 
-        //                   if (m_isRunning.load()) {
-        //                       receiveLoop(scheduler);
-        //                   }
-        //               });
+    // Batches cycle between the reactor and the controller, so steady state allocates nothing
+    auto takeSpareBatch(Shard& t_shard) -> std::unique_ptr<udp::details::ReceiveBatch>
+    {
+        {
+            std::lock_guard lock(t_shard.spareMutex);
+            if (!t_shard.spareBatches.empty()) {
+                auto batch = std::move(t_shard.spareBatches.back());
+                t_shard.spareBatches.pop_back();
+                return batch;
+            }
+        }
 
-        // stdexec::start_detached(std::move(work));
+        auto batch = std::make_unique<udp::details::ReceiveBatch>();
+        batch->packets.reserve(io::IoUringContext::COMPLETION_BATCH_SIZE);
+        batch->buffers.reserve(io::IoUringContext::COMPLETION_BATCH_SIZE);
+        return batch;
     }
 
-    auto receive() -> std::optional<std::pair<udp::UdpProtocol::InputType, sockaddr_in>>
+    auto returnSpareBatch(Shard& t_shard, std::unique_ptr<udp::details::ReceiveBatch> t_batch) -> void
     {
-        // if (!m_isRunning.load()) {
-        //     return std::nullopt;
-        // }
+        std::lock_guard lock(t_shard.spareMutex);
+        t_shard.spareBatches.push_back(std::move(t_batch));
+    }
 
-        // std::array<std::byte, 65536> buffer{};
-        // sockaddr_in clientAddress{};
+    auto startFallback(Shard& t_shard) -> void
+    {
+        if (t_shard.socket->groEnabled()) {
+            t_shard.fallback.emplace(m_options.batchSize, UINT16_MAX, network::UdpSocket::GRO_CONTROL_SIZE);
+        } else {
+            t_shard.fallback.emplace(m_options.batchSize, m_options.maxPacketSize, 0);
+        }
+        pollReadable(t_shard);
+    }
 
-        // auto messageLength = m_ioContext->recvfrom(m_socket, buffer, clientAddress);
-        // if (!m_isRunning.load() || messageLength <= 0) {
-        //     return std::nullopt;
-        // }
+    // Fallback loop: wait for readability through the ring, then drain the socket with recvmmsg
+    auto pollReadable(Shard& t_shard) -> void
+    {
+        if (!m_isRunning.load()) {
+            return;
+        }
 
-        // sockaddr_in localAddress{};
-        // socklen_t localAddressLength = sizeof(localAddress);
-        // getsockname(m_socket, reinterpret_cast<sockaddr*>(&localAddress), &localAddressLength);
+        auto work = t_shard.ioContext->poll(t_shard.socket->nativeHandle(), POLLIN)
+                    | stdexec::then([this, &t_shard](uint32_t /*events*/) {
+                          dispatch([this, &t_shard] {
+                              drainSocket(t_shard);
+                              pollReadable(t_shard);
+                          });
+                      })
+                    | stdexec::upon_error([this, &t_shard](std::exception_ptr t_exceptionPtr) {
+                          try {
+                              std::rethrow_exception(t_exceptionPtr);
+                          } catch (const std::exception& t_exception) {
+                              ZEPHYR_LOG_ERROR(m_logger, "Poll error: {}", t_exception.what());
+                          }
+                          pollReadable(t_shard);
+                      });
 
-        // UdpProtocol::InputType packet{.sourceIp = inet_ntoa(clientAddress.sin_addr),
-        //                               .sourcePort = ntohs(clientAddress.sin_port),
-        //                               .destPort = ntohs(localAddress.sin_port),
-        //                               .clientAddr = clientAddress,
-        //                               .data = {reinterpret_cast<uint8_t*>(buffer.data()),
-        //                                        reinterpret_cast<uint8_t*>(buffer.data()) + messageLength}};
+        stdexec::start_detached(std::move(work));
+    }
 
-        // return std::make_pair(std::move(packet), clientAddress);
-        return std::nullopt;
+    auto drainSocket(Shard& t_shard) -> void
+    {
+        while (true) {
+            auto packets = t_shard.fallback->receive(*t_shard.socket);
+            processPackets(t_shard, packets);
+
+            if (packets.size() < t_shard.fallback->capacity()) {
+                return;
+            }
+        }
     }
 
     Controller m_controller{};
     std::optional<execution::StrandScheduler<BaseScheduler>> m_strand;
     std::atomic<bool> m_isRunning{false};
+    // Batches handed to the strand and not finished yet
+    std::atomic<std::size_t> m_dispatched{0};
     core::Logger::LoggerPtr m_logger;
     network::UdpEndpoint m_endpoint;
-    std::optional<network::UdpSocket> m_socket;
+    udp::UdpServerOptions m_options;
+    std::vector<std::unique_ptr<Shard>> m_shards;
 };
 
 // Deduction guide for scheduler-agnostic construction
@@ -166,4 +434,8 @@ template <typename ControllerArg>
 UdpServer(network::UdpEndpoint,
           ControllerArg&&) -> UdpServer<std::remove_cvref_t<ControllerArg>, exec::__io_uring::__scheduler>;
 
+template <typename ControllerArg>
+UdpServer(network::UdpEndpoint, ControllerArg&&,
+          udp::UdpServerOptions) -> UdpServer<std::remove_cvref_t<ControllerArg>, exec::__io_uring::__scheduler>;
+
 }  // namespace zephyr::plugins
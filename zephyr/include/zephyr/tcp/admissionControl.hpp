@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+
+#include <netinet/in.h>
+
+namespace zephyr::tcp
+{
+// Zero turns a limit off
+struct AdmissionLimits
+{
+    std::size_t max_connections = 10000;
+    // Connections from one address beyond this are refused
+    std::size_t max_connections_per_source = 0;
+    // Accepting pauses while this many sessions wait for a thread of the shared scheduler, and
+    // resumes once half of them have had their turn
+    std::size_t max_queued_sessions = 1024;
+};
+
+enum class AcceptChange
+{
+    none,
+    paused,
+    resumed
+};
+
+// The decisions behind a TcpServer's admission control: which connections it takes, and when it
+// stops accepting so new ones wait in the listen backlog. The counts it is given are the server's;
+// it only keeps the connections per source and whether accepting is paused. Not synchronized.
+class AdmissionControl
+{
+public:
+    explicit AdmissionControl(AdmissionLimits t_limits = {}) : m_limits(t_limits) {}
+
+    // Whether one more connection from t_source fits next to t_connections open ones; an admitted
+    // connection counts for its source until forget()
+    auto admit(std::size_t t_connections, in_addr_t t_source) -> bool;
+    auto forget(in_addr_t t_source) -> void;
+
+    // Called after every accept, and while paused on every check, with the open connections and
+    // the sessions waiting for the scheduler. A paused server only resumes below half the queue
+    // limit and under the connection cap, so it does not flap at the threshold.
+    auto update(std::size_t t_connections, std::size_t t_queued) -> AcceptChange;
+
+    [[nodiscard]] auto paused() const noexcept -> bool { return m_paused; }
+    [[nodiscard]] auto tracks_sources() const noexcept -> bool { return m_limits.max_connections_per_source != 0; }
+    [[nodiscard]] auto connections_from(in_addr_t t_source) const -> std::size_t;
+
+private:
+    auto overloaded(std::size_t t_connections, std::size_t t_queued) const noexcept -> bool;
+
+    AdmissionLimits m_limits;
+    // Only kept with a per-source limit
+    std::unordered_map<in_addr_t, std::size_t> m_per_source;
+    bool m_paused{false};
+};
+}  // namespace zephyr::tcp
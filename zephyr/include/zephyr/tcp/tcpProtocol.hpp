@@ -0,0 +1,61 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/io/bufferRing.hpp"
+#include "zephyr/io/fileRegion.hpp"
+#include "zephyr/io/gatherBuffer.hpp"
+
+namespace zephyr::tcp {
+// What the pipeline expects from the peer once an output is written, which picks the timeout the
+// session applies while it waits
+enum class TcpInputState
+{
+    // The first bytes of a new message
+    idle,
+    // The rest of a message it holds the start of, like a request whose head is incomplete
+    header,
+    // More of a body it hands on as it arrives
+    body
+};
+
+// Bytes to write back, and whether the session closes the connection once they are written
+struct TcpOutput
+{
+    // Bytes to gather-write, or part of a file spliced straight to the socket
+    using Piece = std::variant<io::GatherBuffer, io::FileRegion>;
+    // Completes with the next piece to write, or nullopt once there are none
+    using Producer = std::function<common::ResultSender<std::optional<Piece>>()>;
+
+    io::GatherBuffer data;
+    bool close_after = false;
+    // Called after data and after each piece it gave has been written, until it runs dry. Nothing
+    // further is received by the pipeline meanwhile, so a slow reader holds back the producer.
+    Producer next;
+    TcpInputState awaiting = TcpInputState::idle;
+
+    TcpOutput(io::GatherBuffer t_data, bool t_close_after = false, Producer t_next = nullptr)
+        : data(std::move(t_data)), close_after(t_close_after), next(std::move(t_next)) {}
+
+    // Single segment, for pipelines that already produce one string
+    TcpOutput(std::string t_data) : data(std::move(t_data)) {}
+};
+
+struct TcpProtocol
+{
+    // Received bytes; the view is only valid until the pipeline lets go of it
+    using InputType = io::ProvidedBuffer;
+    // Written with one sendmsg
+    using OutputType = std::optional<TcpOutput>;
+    using ResultSenderType = common::ResultSender<OutputType>;
+
+    static constexpr auto socket_type = SOCK_STREAM;
+    static constexpr auto name = "TCP";
+};
+}
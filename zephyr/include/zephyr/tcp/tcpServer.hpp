@@ -0,0 +1,454 @@
+#pragma once
+
+#include <stdexec/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "zephyr/common/slab.hpp"
+#include "zephyr/execution/strandScheduler.hpp"
+#include "zephyr/io/bufferRing.hpp"
+#include "zephyr/io/ioUringContext.hpp"
+#include "zephyr/tcp/admissionControl.hpp"
+#include "zephyr/tcp/tcpSession.hpp"
+
+namespace zephyr::tcp
+{
+struct TcpServerOptions
+{
+    // Connections the kernel queues while the server is not accepting; capped by net.core.somaxconn
+    int listen_backlog = SOMAXCONN;
+    // Accept into the ring's registered file table (direct descriptors) when the kernel supports it
+    bool fixed_files = true;
+    uint32_t fixed_file_slots = 4096;
+    // Receive buffers shared by all sessions (multishot recv); the count has to be a power of two
+    uint32_t receive_buffers = 1024;
+    uint32_t receive_buffer_size = 4096;
+    // The share of those one session may hold
+    TcpReceiveOptions receives;
+    // SO_REUSEPORT: run one TcpServer per reactor (IoUringContext on its own, pinned thread) on the
+    // same port and the kernel spreads connections across them
+    bool reuse_port = false;
+    // Enforced on every session through the reactor's timer wheel
+    TcpSessionTimeouts timeouts;
+    // Write batching (corking) and the zero-copy threshold
+    TcpWriteOptions writes;
+
+    // Sessions still closing count as connections, so the cap bounds the memory they hold.
+    // Refused connections are closed as soon as they are accepted. Telling sources apart takes the
+    // peer address, which a direct descriptor cannot be asked for, so a per-source limit turns
+    // fixed_files off.
+    AdmissionLimits admission;
+    // How often a paused server checks whether it may accept again
+    std::chrono::milliseconds accept_pause{10};
+};
+
+template<typename Scheduler, typename PipelineFactory>
+    requires std::invocable<PipelineFactory>
+class TcpServer {
+    using PipelineType = std::invoke_result_t<PipelineFactory>;
+    using Session = zephyr::tcp::TcpSession<PipelineType, Scheduler>;
+    
+    struct AcceptHandler {
+        TcpServer* server;
+        void operator()(int32_t result, uint32_t flags) const noexcept {
+            server->on_accept(result, flags);
+            // The arming is over once its final CQE has been handled
+            if (!io::has_more(flags)) server->work_done();
+        }
+    };
+
+    // What the server keeps per descriptor; key stands for the server's reference to the session
+    struct Connection {
+        typename common::Slab<Session>::Key key;
+        in_addr_t source = 0;
+    };
+    
+    int listen_socket_ = -1;
+    Scheduler scheduler_;
+    PipelineFactory pipeline_factory_;
+    std::shared_ptr<zephyr::io::IoUringContext> io_ctx_;
+    TcpServerOptions options_;
+    std::atomic<bool> is_running_{true};
+    bool use_fixed_files_ = false;
+    bool single_shot_accept_ = false;
+    std::optional<io::MultishotAccept<AcceptHandler>> accept_op_;
+    std::shared_ptr<io::BufferRing> receive_buffers_;
+    // Sessions live in recycled slab slots, so connection churn does not reach the allocator.
+    // connections_ is indexed by descriptor (or direct descriptor slot).
+    std::mutex sessions_mutex_;
+    common::Slab<Session> sessions_;
+    std::vector<Connection> connections_;
+    // Guarded by sessions_mutex_; whether accepting is paused only changes on the reactor thread
+    AdmissionControl admission_;
+    // Strands of every session report here how many of them wait for the scheduler
+    std::shared_ptr<execution::QueueDepth> queue_depth_ = std::make_shared<execution::QueueDepth>();
+    // Work that calls back into the server: the armed accept, accept retries, load checks and
+    // single-shot accepts. Taken without the lock, but only given back under sessions_mutex_, where
+    // drained_ is notified together with the sessions going back to the slab.
+    std::atomic<std::size_t> pending_work_{0};
+    std::condition_variable drained_;
+    
+public:
+    TcpServer(Scheduler sched, PipelineFactory factory, 
+              std::shared_ptr<zephyr::io::IoUringContext> io,
+              TcpServerOptions options = {})
+        : scheduler_(sched)
+        , pipeline_factory_(std::move(factory))
+        , io_ctx_(std::move(io))
+        , options_(options)
+        , admission_(options.admission) {}
+    
+    // Waits for everything that points back at the server: the accept and its retries, and every
+    // session, whose callbacks reach into the slab and which only goes back to it once its last
+    // operation and strand task are done. Only the server's own work is waited for, the context
+    // may be shared; a context that is neither running nor stopped never ran any of it.
+    // That work finishes on the reactor thread, so the server cannot be destroyed there.
+    ~TcpServer() {
+        assert(!io_ctx_->on_reactor_thread() && "TcpServer destroyed on its reactor thread");
+        stop();
+        if (!io_ctx_->is_running() && !io_ctx_->is_stopped()) return;
+
+        std::unique_lock lock(sessions_mutex_);
+        drained_.wait(lock, [this] { return drained(); });
+    }
+    
+    bool listen(uint16_t port) {
+        listen_socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_socket_ < 0) return false;
+        
+        int opt = 1;
+        setsockopt(listen_socket_, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        if (options_.reuse_port && setsockopt(listen_socket_, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) < 0) {
+            ::close(listen_socket_);
+            return false;
+        }
+        fcntl(listen_socket_, F_SETFL, O_NONBLOCK);
+        
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = INADDR_ANY;
+        addr.sin_port = htons(port);
+        
+        if (::bind(listen_socket_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+            ::listen(listen_socket_, options_.listen_backlog) < 0) {
+            ::close(listen_socket_);
+            return false;
+        }
+        
+        const auto fixed_files = options_.fixed_files && options_.admission.max_connections_per_source == 0;
+        if (fixed_files && !io_ctx_->has_registered_files()) {
+            try {
+                io_ctx_->register_files(options_.fixed_file_slots);
+            } catch (const std::exception& ex) {
+                std::cout << "[TCP Server] Direct descriptors unavailable: " << ex.what() << "\n";
+            }
+        }
+        use_fixed_files_ = fixed_files && io_ctx_->has_registered_files();
+        
+        if (options_.receive_buffers > 0 && !receive_buffers_) {
+            try {
+                receive_buffers_ = std::make_shared<io::BufferRing>(*io_ctx_, options_.receive_buffers,
+                                                                    options_.receive_buffer_size);
+            } catch (const std::exception& ex) {
+                std::cout << "[TCP Server] Provided buffers unavailable: " << ex.what() << "\n";
+            }
+        }
+        
+        std::cout << "[TCP Server] Listening on port " << port << "\n";
+        return true;
+    }
+    
+    // One multishot accept SQE produces every connection; it is only re-armed when the kernel ends it
+    void run() {
+        accept_op_.emplace(*io_ctx_, io::MultishotAcceptPrep{.fd = listen_socket_, .direct = use_fixed_files_},
+                           AcceptHandler{this});
+        arm_accept();
+    }
+    
+    // Stops accepting and closes every session. The context is left running; whoever owns it
+    // stops it.
+    void stop() {
+        if (!is_running_.exchange(false)) return;
+
+        if (accept_op_) accept_op_->cancel();
+        if (listen_socket_ >= 0) {
+            // Wakes an accept still waiting on the socket, multishot or not, with EINVAL
+            ::shutdown(listen_socket_, SHUT_RDWR);
+            ::close(listen_socket_);
+            listen_socket_ = -1;
+        }
+        close_sessions();
+    }
+    
+private:
+    void close_sessions() {
+        std::vector<typename Session::Ref> live;
+        {
+            std::lock_guard lock(sessions_mutex_);
+            for (const auto& connection : connections_) {
+                if (auto* session = sessions_.get(connection.key)) live.emplace_back(session);
+            }
+        }
+
+        // Outside the lock: closing removes the session, which takes it again
+        for (auto& session : live) session->stop();
+    }
+
+    // Called with sessions_mutex_ held
+    bool drained() {
+        return pending_work_.load(std::memory_order_acquire) == 0 && sessions_.size() == 0;
+    }
+
+    // The last thing a piece of counted work does; the destructor may go ahead as soon as the
+    // lock is released
+    void work_done() {
+        std::lock_guard lock(sessions_mutex_);
+        pending_work_.fetch_sub(1, std::memory_order_release);
+        drained_.notify_all();
+    }
+
+    // Starts work that refers to the server and counts it until it has completed, however it does
+    template<typename Work>
+    void spawn(Work&& work) {
+        pending_work_.fetch_add(1, std::memory_order_relaxed);
+        auto done = [this] { work_done(); };
+        stdexec::start_detached(std::forward<Work>(work)
+            | stdexec::then(done)
+            | stdexec::upon_error([done](std::exception_ptr) { done(); })
+            | stdexec::upon_stopped(done));
+    }
+
+    void arm_accept() {
+        if (!is_running_.load()) return;
+        
+        pending_work_.fetch_add(1, std::memory_order_relaxed);
+        if (auto result = accept_op_->arm(); result != 0) {
+            work_done();
+            if (result != ECANCELED) {
+                std::cout << "[TCP Server] Cannot arm accept: " << std::strerror(result) << "\n";
+            }
+        }
+    }
+    
+    // Runs on the reactor thread for every accept CQE
+    void on_accept(int32_t result, uint32_t flags) {
+        const io::FileHandle socket{result, use_fixed_files_};
+        
+        if (result >= 0) {
+            if (is_running_.load()) {
+                add_session(socket);
+                if (update_load() == AcceptChange::paused) pause_accept();
+            } else {
+                io_ctx_->close(socket);
+            }
+        } else if (result != -ECANCELED) {
+            std::cout << "[TCP Server] Accept error: " << std::strerror(-result) << "\n";
+        }
+        
+        if (io::has_more(flags) || !is_running_.load()) return;
+        // Cancelled to pause; check_load() arms it again
+        if (paused()) return;
+        
+        switch (-result) {
+            case EINVAL:
+            case EOPNOTSUPP:
+                // Kernel without direct descriptors or multishot accept
+                if (use_fixed_files_) {
+                    use_fixed_files_ = false;
+                    accept_op_->prep().direct = false;
+                    arm_accept();
+                } else {
+                    single_shot_accept_ = true;
+                    accept_loop();
+                }
+                break;
+            case EMFILE:
+            case ENFILE:
+                retry_accept_later();
+                break;
+            default:
+                arm_accept();
+                break;
+        }
+    }
+    
+    // Runs on the reactor thread, the only place sessions are added, so nothing changes between
+    // the admission check and the insertion
+    void add_session(io::FileHandle socket) {
+        const auto source = admission_.tracks_sources() ? peer_address(socket.fd) : in_addr_t{0};
+        if (!admit(source)) {
+            std::cout << "[TCP Server] Connection refused: " << (socket.fixed ? "slot=" : "fd=") << socket.fd << "\n";
+            io_ctx_->close(socket);
+            return;
+        }
+
+        std::cout << "[TCP Server] New connection: " << (socket.fixed ? "slot=" : "fd=") << socket.fd << "\n";
+        auto pipeline = pipeline_factory_();
+        auto strand = execution::StrandScheduler<Scheduler>{scheduler_, {.queueDepth = queue_depth_}};
+        Session* session = nullptr;
+        {
+            std::lock_guard lock(sessions_mutex_);
+            auto [key, created] = sessions_.emplace(
+                socket, std::move(pipeline), std::move(strand), io_ctx_, receive_buffers_, options_.timeouts, options_.receives,
+                options_.writes,
+                [this](int fd) { remove_session(fd); },
+                [this](Session* released) { recycle_session(released); }
+            );
+            if (connections_.size() <= static_cast<std::size_t>(socket.fd)) {
+                connections_.resize(static_cast<std::size_t>(socket.fd) + 1);
+            }
+            connections_[socket.fd] = Connection{key, source};
+            session = created;
+        }
+        session->start();
+        // stop() ran between the accept and the insertion, so it did not see this session
+        if (!is_running_.load()) session->stop();
+    }
+
+    // Whether one more connection from source fits under the limits; counts it when it does
+    bool admit(in_addr_t source) {
+        std::lock_guard lock(sessions_mutex_);
+        return admission_.admit(sessions_.size(), source);
+    }
+
+    static in_addr_t peer_address(int fd) {
+        sockaddr_in address{};
+        socklen_t length = sizeof(address);
+        if (::getpeername(fd, reinterpret_cast<sockaddr*>(&address), &length) != 0) return 0;
+        return address.sin_addr.s_addr;
+    }
+
+    // Runs on the reactor thread; pauses at the connection cap or with too many sessions waiting
+    // for the scheduler, and resumes once the load has gone well below that
+    AcceptChange update_load() {
+        std::lock_guard lock(sessions_mutex_);
+        return admission_.update(sessions_.size(), queue_depth_->value());
+    }
+
+    bool paused() {
+        std::lock_guard lock(sessions_mutex_);
+        return admission_.paused();
+    }
+
+    // Runs on the reactor thread. New connections wait in the listen backlog, and past it the
+    // kernel holds back their handshakes, so clients slow down instead of the server running out.
+    void pause_accept() {
+        std::cout << "[TCP Server] Overloaded, accepting paused\n";
+        if (accept_op_) accept_op_->cancel();
+        check_load();
+    }
+
+    void check_load() {
+        auto work = io_ctx_->schedule_after(options_.accept_pause)
+            | stdexec::then([this] {
+                if (!is_running_.load()) return;
+                if (update_load() != AcceptChange::resumed) {
+                    // An accept already on its way may have resumed it; the accept's final CQE
+                    // then arms it again
+                    if (paused()) check_load();
+                    return;
+                }
+
+                std::cout << "[TCP Server] Accepting resumed\n";
+                if (single_shot_accept_) {
+                    accept_loop();
+                } else if (!accept_op_->is_armed()) {
+                    // Still armed: the cancel has not landed yet, and its final CQE re-arms it
+                    arm_accept();
+                }
+            });
+        spawn(std::move(work));
+    }
+    
+    void remove_session(int fd) {
+        Session* session = nullptr;
+        {
+            std::lock_guard lock(sessions_mutex_);
+            if (static_cast<std::size_t>(fd) < connections_.size()) {
+                auto connection = std::exchange(connections_[fd], {});
+                session = sessions_.get(connection.key);
+                if (session) admission_.forget(connection.source);
+            }
+        }
+        if (!session) return;
+        
+        std::cout << "[TCP Server] Removing session fd=" << fd << "\n";
+        // Outside the lock: dropping the last reference recycles the session, which takes it again
+        session->release();
+    }
+    
+    // The last reference to a session is gone; its slot is reused by the next connection
+    void recycle_session(Session* session) {
+        std::lock_guard lock(sessions_mutex_);
+        sessions_.erase(session);
+        drained_.notify_all();
+    }
+    
+    // Out of descriptors: try again once some connections have had a chance to close
+    void retry_accept_later() {
+        auto work = io_ctx_->schedule_after(std::chrono::milliseconds(100))
+            | stdexec::then([this] {
+                if (single_shot_accept_) {
+                    accept_loop();
+                } else {
+                    arm_accept();
+                }
+            });
+        spawn(std::move(work));
+    }
+    
+    // Single-shot fallback for kernels without multishot accept
+    void accept_loop() {
+        if (!is_running_.load()) return;
+        
+        auto work = io_ctx_->accept(listen_socket_)
+            | stdexec::then([this](int client_fd) {
+                if (!is_running_.load()) {
+                    ::close(client_fd);
+                    return;
+                }
+                
+                add_session(io::FileHandle{client_fd});
+                if (update_load() == AcceptChange::paused) {
+                    pause_accept();
+                    return;
+                }
+                accept_loop();
+            })
+            | stdexec::upon_error([this](std::exception_ptr) {
+                if (is_running_.load()) retry_accept_later();
+            });
+        
+        spawn(std::move(work));
+    }
+};
+
+template<typename Scheduler, typename PipelineFactory>
+auto make_tcp_server(Scheduler sched, PipelineFactory&& factory,
+                     std::shared_ptr<zephyr::io::IoUringContext> io,
+                     TcpServerOptions options = {}) {
+    return TcpServer<Scheduler, std::decay_t<PipelineFactory>>(
+        sched, std::forward<PipelineFactory>(factory), std::move(io), options);
+}
+}
@@ -0,0 +1,684 @@
+#pragma once
+
+#include "zephyr/common/intrusivePtr.hpp"
+#include "zephyr/common/resultSender.hpp"
+#include "zephyr/execution/strandScheduler.hpp"
+#include "zephyr/pipeline/pipelineConcept.hpp"
+#include "zephyr/tcp/tcpProtocol.hpp"
+#include <zephyr/io/bufferRing.hpp>
+#include <zephyr/io/gatherBuffer.hpp>
+#include <zephyr/io/ioUringContext.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <variant>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace zephyr::tcp
+{
+// How long a session waits on its peer before closing the connection; zero turns a limit off
+struct TcpSessionTimeouts
+{
+    // For the first bytes of the next message
+    std::chrono::milliseconds idle{std::chrono::seconds{60}};
+    // For a message to be complete once its first bytes are in, however slowly they trickle
+    std::chrono::milliseconds header{std::chrono::seconds{10}};
+    // Between two reads of a body the pipeline hands on as it arrives
+    std::chrono::milliseconds body{std::chrono::seconds{30}};
+    // For each write to be taken by the peer
+    std::chrono::milliseconds write{std::chrono::seconds{30}};
+};
+
+// How much of the receive buffers all sessions share one of them may hold
+struct TcpReceiveOptions
+{
+    // Received buffers waiting for the pipeline before the session stops receiving; the peer's data
+    // then waits in the socket, where TCP flow control holds it back. Receiving resumes once half
+    // of them have been processed. Zero turns the limit off.
+    std::size_t max_buffers = 16;
+};
+
+// How a session batches what it writes
+struct TcpWriteOptions
+{
+    // Outputs for chunks that are already received are queued and written together, up to this many bytes
+    std::size_t max_batch_bytes = 256 * 1024;
+    // Batches at least this large are sent zero-copy; zero turns it off. Pinning pages costs more
+    // than copying small writes, and the batch is only released once the kernel is done with it.
+    std::size_t zero_copy_threshold = 0;
+};
+
+// Everything a session does runs on its strand, a queue over the server's shared scheduler, so its
+// state needs no locks and a connection costs no thread of its own.
+//
+// The reference count lives in the session: it starts at one, held by whoever created it, and every
+// operation in flight holds another. When the last one goes the session is handed to the release
+// callback, so its storage can be recycled, or deleted when there is none.
+//
+// Outputs are corked: while more received chunks wait, each one goes through the pipeline and its
+// output joins the session's queue, and the queue is written with one sendmsg once the input runs
+// out. Pipelined requests are answered in one write instead of one segment per response.
+//
+// Every session receives into the same provided-buffer ring, so each one has a budget of buffers
+// it may hold; past it, its multishot receive is cancelled until the strand has caught up. One
+// slow or heavily pipelining peer cannot stall the receives of every other connection.
+//
+// A single deadline in the reactor's timer wheel enforces the timeouts. It is moved whenever the
+// session changes from waiting on its peer to writing or back, and holds a reference while it is set.
+template<pipeline::PipelineConcept<TcpProtocol> Pipeline, stdexec::scheduler Scheduler>
+class TcpSession {
+public:
+    using Ref = common::IntrusivePtr<TcpSession>;
+    using OnCloseCallback = std::function<void(int)>;
+    using OnReleaseCallback = std::function<void(TcpSession*)>;
+
+private:
+    struct ReceiveHandler {
+        TcpSession* session;
+        void operator()(int32_t result, uint32_t flags) const noexcept { session->on_receive(result, flags); }
+    };
+
+    static constexpr std::size_t fallback_buffer_size = 4096;
+
+    // A pause cancels the multishot receive; it is only armed again after the final CQE, by the
+    // reactor when the strand caught up meanwhile, or by the strand otherwise
+    enum class ReceiveState : uint8_t { running, pausing, paused };
+
+    struct Deadline : io::TimerNode {
+        TcpSession* session = nullptr;
+    };
+
+    // What write_next() does after a piece: stop, splice a file region, write bytes, or pull again
+    struct WriteStep {
+        bool done = false;
+        std::optional<io::FileRegion> file;
+        io::GatherBuffer data;
+    };
+
+    static constexpr std::size_t max_pipe_size = 1024 * 1024;
+
+    io::FileHandle socket_;
+    execution::StrandScheduler<Scheduler> strand_;
+    Pipeline pipeline_;
+    std::shared_ptr<io::IoUringContext> io_ctx_;
+    std::shared_ptr<io::BufferRing> buffers_;
+    std::shared_ptr<context::Context> context_;
+    OnCloseCallback on_close_;
+    OnReleaseCallback on_release_;
+    std::atomic<bool> is_active_{true};
+    std::atomic<uint32_t> refs_{1};
+
+    // Only the latest generation of the deadline closes the session; an older one that fired while
+    // it was being moved is ignored
+    TcpSessionTimeouts timeouts_;
+    TcpReceiveOptions receives_;
+    TcpWriteOptions writes_;
+    Deadline deadline_;
+    std::atomic<uint64_t> deadline_generation_{0};
+
+    // Multishot receive; keep_alive_ pins the session while the operation is armed
+    std::optional<io::MultishotReceive<ReceiveHandler>> receive_op_;
+    Ref keep_alive_;
+    // Ring buffers taken by the reactor and not yet handed to the pipeline
+    std::atomic<std::size_t> held_buffers_{0};
+    std::atomic<ReceiveState> receive_state_{ReceiveState::running};
+
+    // Strand-only state: received chunks wait here so the pipeline sees them one at a time, in order
+    std::deque<io::ProvidedBuffer> pending_;
+    bool processing_ = false;
+    // The peer has shut down its side; the session closes once everything before that is answered
+    bool input_finished_ = false;
+    TcpInputState awaiting_ = TcpInputState::idle;
+    io::IoUringContext::Clock::time_point message_started_;
+    // Outputs waiting to be written together; untouched while a write of it is in flight
+    io::GatherBuffer out_;
+    // Cleared for good when the kernel turns down a zero-copy send
+    std::atomic<bool> zero_copy_{true};
+
+    // Single-shot fallback when the kernel has no provided buffer rings
+    std::unique_ptr<std::byte[]> read_buffer_;
+
+    // Pipe for splicing file regions; the default capacity until open_pipe() learns the real one
+    int pipe_[2] = {-1, -1};
+    std::size_t pipe_capacity_ = 64 * 1024;
+
+public:
+    TcpSession(io::FileHandle socket, Pipeline pipeline, execution::StrandScheduler<Scheduler> strand,
+               std::shared_ptr<io::IoUringContext> io, std::shared_ptr<io::BufferRing> buffers,
+               TcpSessionTimeouts timeouts = {}, TcpReceiveOptions receives = {}, TcpWriteOptions writes = {},
+               OnCloseCallback on_close = nullptr, OnReleaseCallback on_release = nullptr)
+        : socket_(socket)
+        , strand_(std::move(strand))
+        , pipeline_(std::move(pipeline))
+        , io_ctx_(std::move(io))
+        , buffers_(std::move(buffers))
+        , context_(std::make_shared<context::Context>())
+        , on_close_(std::move(on_close))
+        , on_release_(std::move(on_release))
+        , timeouts_(timeouts)
+        , receives_(receives)
+        , writes_(writes)
+    {
+        deadline_.fire = &TcpSession::on_deadline;
+        deadline_.session = this;
+        std::cout << "[TCP:" << socket_.fd << "] Session created\n";
+    }
+
+    ~TcpSession() {
+        std::cout << "[TCP:" << socket_.fd << "] Session destroyed\n";
+        pending_.clear();
+        if (pipe_[0] >= 0) {
+            io_ctx_->close(io::FileHandle{pipe_[0]});
+            io_ctx_->close(io::FileHandle{pipe_[1]});
+        }
+        if (socket_.fd >= 0) io_ctx_->close(socket_);
+    }
+
+    void start() {
+        set_deadline(timeouts_.idle);
+
+        if (!buffers_) {
+            read_buffer_ = std::make_unique<std::byte[]>(fallback_buffer_size);
+            read_loop();
+            return;
+        }
+
+        receive_op_.emplace(*io_ctx_, io::MultishotReceivePrep{.file = socket_, .buffer_group = buffers_->group_id()},
+                            ReceiveHandler{this});
+        arm_receive();
+    }
+
+    // Closes the connection from outside: cancels whatever is in flight on the socket, so a write
+    // to a peer that stopped reading ends too, and hands the session back to its owner
+    void stop() {
+        if (!is_active_) return;
+        io_ctx_->cancel(socket_);
+        close();
+    }
+
+    int fd() const { return socket_.fd; }
+
+    void add_ref() noexcept { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        if (on_release_) {
+            on_release_(this);
+        } else {
+            delete this;
+        }
+    }
+
+private:
+    void arm_receive() {
+        if (!is_active_) return;
+
+        keep_alive_ = Ref{this};
+        if (auto result = receive_op_->arm(); result != 0) {
+            auto self = std::exchange(keep_alive_, nullptr);
+            if (result != ECANCELED) {
+                std::cout << "[TCP:" << socket_.fd << "] Cannot arm receive: " << std::strerror(result) << "\n";
+            }
+            close();
+        }
+    }
+
+    // Runs on the reactor thread for every receive CQE
+    void on_receive(int32_t result, uint32_t flags) {
+        if (result > 0) {
+            // Counted before the strand can see it, which then takes it off again
+            const auto held = held_buffers_.fetch_add(1, std::memory_order_acq_rel) + 1;
+            enqueue(buffers_->take(flags, static_cast<std::size_t>(result)));
+            if (receives_.max_buffers != 0 && held >= receives_.max_buffers) pause_receive();
+        } else if (result == 0) {
+            std::cout << "[TCP:" << socket_.fd << "] Connection closed by peer\n";
+            finish_input();
+        } else if (result != -ENOBUFS && result != -ECANCELED) {
+            std::cout << "[TCP:" << socket_.fd << "] Receive error: " << std::strerror(-result) << "\n";
+            close();
+        }
+
+        if (io::has_more(flags)) return;
+
+        // Final CQE: the session may only go away after this point
+        auto self = std::exchange(keep_alive_, nullptr);
+        if (!is_active_ || result == 0) return;
+
+        if (receive_state_.load(std::memory_order_acquire) == ReceiveState::pausing) {
+            receive_state_.store(ReceiveState::paused, std::memory_order_release);
+            // The strand may have caught up before it could see the receive paused
+            if (!over_resume_mark()) resume_receive();
+            return;
+        }
+
+        if (result == -ENOBUFS) {
+            // Every buffer is held by a pipeline; resume once one comes back
+            buffers_->when_available([self] { self->arm_receive(); });
+        } else if (result > 0) {
+            arm_receive();
+        } else if (result == -ECANCELED) {
+            close();
+        }
+    }
+
+    // Runs on the reactor thread once the session holds its whole budget
+    void pause_receive() {
+        auto expected = ReceiveState::running;
+        if (!receive_state_.compare_exchange_strong(expected, ReceiveState::pausing, std::memory_order_acq_rel)) return;
+
+        std::cout << "[TCP:" << socket_.fd << "] Receive paused\n";
+        receive_op_->cancel();
+    }
+
+    // Any thread; only whoever moves the receive out of paused arms it
+    void resume_receive() {
+        auto expected = ReceiveState::paused;
+        if (!receive_state_.compare_exchange_strong(expected, ReceiveState::running, std::memory_order_acq_rel)) return;
+
+        std::cout << "[TCP:" << socket_.fd << "] Receive resumed\n";
+        arm_receive();
+    }
+
+    bool over_resume_mark() const {
+        return held_buffers_.load(std::memory_order_acquire) > receives_.max_buffers / 2;
+    }
+
+    void enqueue(io::ProvidedBuffer buffer) {
+        auto work = stdexec::schedule(strand_)
+            | stdexec::then([self = Ref{this}, buffer = std::move(buffer)]() mutable {
+                self->pending_.push_back(std::move(buffer));
+                if (!self->processing_) self->process_next();
+            });
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Posted behind the chunks received before the end of the input, so they are all answered
+    // before the session closes; a half-closed peer still reads the replies
+    void finish_input() {
+        auto work = stdexec::schedule(strand_)
+            | stdexec::then([self = Ref{this}] {
+                self->input_finished_ = true;
+                if (!self->processing_) self->process_next();
+            });
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Runs on the strand; feeds one chunk through the pipeline and queues its output. The queue is
+    // written when no chunk is left, when it has grown to max_batch_bytes, and before a streamed
+    // output or a close, which have to follow everything queued before them.
+    void process_next() {
+        if (!is_active_) {
+            processing_ = false;
+            return;
+        }
+
+        if (!out_.empty() && (pending_.empty() || out_.size() >= writes_.max_batch_bytes)) {
+            flush(nullptr, false);
+            return;
+        }
+
+        if (pending_.empty()) {
+            processing_ = false;
+            if (input_finished_) {
+                close();
+                return;
+            }
+            await_input();
+            if (!buffers_) read_loop();
+            return;
+        }
+
+        // The peer is not waiting on anything while the pipeline runs
+        clear_deadline();
+        processing_ = true;
+        auto self = Ref{this};
+        auto input = std::move(pending_.front());
+        pending_.pop_front();
+        if (buffers_) {
+            held_buffers_.fetch_sub(1, std::memory_order_acq_rel);
+            if (!over_resume_mark()) resume_receive();
+        }
+
+        std::cout << "[TCP:" << socket_.fd << "] Received " << input.size() << " bytes\n";
+
+        auto work = pipeline_(std::move(input), context_)
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self](TcpProtocol::OutputType result) {
+                // No output at all means the pipeline is waiting for the rest of a message
+                if (!result) {
+                    self->expect(TcpInputState::header);
+                    self->process_next();
+                    return;
+                }
+
+                self->expect(result->awaiting);
+                self->out_.append(std::move(result->data));
+                if (result->next || result->close_after) {
+                    self->flush(std::move(result->next), result->close_after);
+                    return;
+                }
+                self->process_next();
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) { self->fail(e); })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Runs on the strand; writes the queue with one sendmsg, and what a short write left with another,
+    // then goes on with the streamed output or with the next chunk
+    void flush(TcpOutput::Producer next, bool close_after) {
+        if (!is_active_) {
+            processing_ = false;
+            return;
+        }
+
+        if (out_.empty()) {
+            if (next) {
+                write_next(std::move(next), close_after);
+            } else {
+                finish_output(close_after);
+            }
+            return;
+        }
+
+        set_deadline(timeouts_.write);
+        auto self = Ref{this};
+        const auto zero_copy = writes_.zero_copy_threshold != 0 && out_.size() >= writes_.zero_copy_threshold
+            && zero_copy_.load(std::memory_order_relaxed);
+
+        using SendSender = common::ResultSender<std::size_t>;
+        auto send = zero_copy
+            ? SendSender{io_ctx_->send_zero_copy(socket_, out_.vectors())
+                | stdexec::let_error([self](std::exception_ptr e) { return self->send_copied(e); })}
+            : SendSender{io_ctx_->send(socket_, out_.vectors())};
+
+        auto work = std::move(send)
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self, next = std::move(next), close_after](std::size_t sent) mutable {
+                if (sent == 0) throw std::runtime_error("peer took nothing");
+                std::cout << "[TCP:" << self->socket_.fd << "] Sent " << sent << " bytes\n";
+                self->out_.consume(sent);
+                self->flush(std::move(next), close_after);
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) { self->fail(e); })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // A kernel without zero-copy sends turns them down with EINVAL or EOPNOTSUPP; the session sends
+    // the batch again the usual way and stops asking
+    auto send_copied(std::exception_ptr e) -> common::ResultSender<std::size_t> {
+        try { std::rethrow_exception(e); }
+        catch (const std::system_error& ex) {
+            if (ex.code().value() == EINVAL || ex.code().value() == EOPNOTSUPP) {
+                zero_copy_.store(false, std::memory_order_relaxed);
+                return common::ResultSender<std::size_t>{io_ctx_->send(socket_, out_.vectors())};
+            }
+        }
+        catch (...) {}
+        return common::ResultSender<std::size_t>{stdexec::just_error(e)};
+    }
+
+    // Runs on the strand; pulls the next piece of a streamed output and writes it. The next pull only
+    // happens once the piece is on the socket, which is what holds back a producer faster than the peer.
+    // Bytes go out through flush(), which sends again whatever a short write left of them.
+    void write_next(TcpOutput::Producer next, bool close_after) {
+        if (!is_active_) {
+            processing_ = false;
+            return;
+        }
+
+        // A producer waiting on its source is not the peer's doing
+        clear_deadline();
+        auto self = Ref{this};
+        auto pull = next();
+
+        auto work = std::move(pull)
+            | stdexec::then([](std::optional<TcpOutput::Piece> piece) {
+                // nullopt: the producer is done; an empty piece is skipped but the loop goes on
+                if (!piece) return WriteStep{.done = true};
+                if (auto* region = std::get_if<io::FileRegion>(&*piece)) {
+                    return WriteStep{.file = std::move(*region)};
+                }
+                return WriteStep{.data = std::get<io::GatherBuffer>(std::move(*piece))};
+            })
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self, next = std::move(next), close_after](WriteStep step) mutable {
+                if (step.done) {
+                    self->finish_output(close_after);
+                } else if (step.file) {
+                    self->write_file(std::move(*step.file), std::move(next), close_after);
+                } else if (!step.data.empty()) {
+                    // out_ is empty while a streamed output is written, so the piece takes its place
+                    self->out_ = std::move(step.data);
+                    self->flush(std::move(next), close_after);
+                } else {
+                    self->write_next(std::move(next), close_after);
+                }
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) { self->fail(e); })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Runs on the strand; file -> pipe -> socket, one pipe's worth per round, so the file's bytes
+    // never pass through user space. The producer is pulled again once the region is out.
+    void write_file(io::FileRegion region, TcpOutput::Producer next, bool close_after) {
+        if (!is_active_) {
+            processing_ = false;
+            return;
+        }
+
+        if (region.length == 0) {
+            write_next(std::move(next), close_after);
+            return;
+        }
+
+        if (!open_pipe()) {
+            fail(std::make_exception_ptr(std::system_error(errno, std::system_category(), "pipe")));
+            return;
+        }
+
+        set_deadline(timeouts_.write);
+        auto self = Ref{this};
+        const auto step = static_cast<uint32_t>(std::min(region.length, pipe_capacity_));
+
+        auto work = io_ctx_->splice(io::FileHandle{region.fd}, static_cast<int64_t>(region.offset),
+                                    io::FileHandle{pipe_[1]}, -1, step)
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self, region = std::move(region), next = std::move(next), close_after](std::size_t filled) mutable {
+                if (filled == 0) throw std::runtime_error("file ended before its response");
+                region.offset += filled;
+                region.length -= filled;
+                self->drain_pipe(filled, std::move(region), std::move(next), close_after);
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) { self->fail(e); })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Runs on the strand; moves in_pipe bytes from the pipe to the socket, waiting for room in the
+    // send buffer whenever the non-blocking socket has none
+    void drain_pipe(std::size_t in_pipe, io::FileRegion region, TcpOutput::Producer next, bool close_after) {
+        set_deadline(timeouts_.write);
+        auto self = Ref{this};
+        const auto length = static_cast<uint32_t>(in_pipe);
+
+        auto work = io_ctx_->splice(io::FileHandle{pipe_[0]}, -1, socket_, -1, length)
+            | stdexec::upon_error([](std::exception_ptr e) -> std::size_t {
+                try { std::rethrow_exception(e); }
+                catch (const std::system_error& ex) {
+                    if (ex.code().value() != EAGAIN) throw;
+                }
+                return 0;
+            })
+            | stdexec::let_value([self](std::size_t sent) {
+                using SpliceSender = common::ResultSender<std::size_t>;
+                if (sent != 0) return SpliceSender{stdexec::just(sent)};
+                return SpliceSender{self->io_ctx_->poll(self->socket_, POLLOUT)
+                    | stdexec::then([](uint32_t) { return std::size_t{0}; })};
+            })
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self, in_pipe, region = std::move(region), next = std::move(next), close_after](std::size_t sent) mutable {
+                if (sent < in_pipe) {
+                    self->drain_pipe(in_pipe - sent, std::move(region), std::move(next), close_after);
+                    return;
+                }
+                self->write_file(std::move(region), std::move(next), close_after);
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) { self->fail(e); })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // The pipe file regions are spliced through, created on first use and kept for the session
+    bool open_pipe() {
+        if (pipe_[0] >= 0) return true;
+        if (::pipe2(pipe_, O_CLOEXEC) != 0) return false;
+
+        // A larger pipe means fewer rounds per file; the default size is fine when raising it is refused
+        ::fcntl(pipe_[1], F_SETPIPE_SZ, static_cast<int>(max_pipe_size));
+        if (auto size = ::fcntl(pipe_[1], F_GETPIPE_SZ); size > 0) pipe_capacity_ = static_cast<std::size_t>(size);
+        return true;
+    }
+
+    void fail(std::exception_ptr e) {
+        try { std::rethrow_exception(e); }
+        catch (const std::exception& ex) {
+            std::cout << "[TCP:" << socket_.fd << "] Error: " << ex.what() << "\n";
+        }
+        close();
+    }
+
+    // Runs on the strand once everything the pipeline produced for a chunk has been written
+    void finish_output(bool close_after) {
+        if (close_after) {
+            // The response carried Connection: close; drop whatever else was received
+            pending_.clear();
+            processing_ = false;
+            close();
+            return;
+        }
+        process_next();
+    }
+
+    // Fallback: one receive at a time into the session's own buffer, re-armed by process_next()
+    // after the pipeline is done with the previous chunk
+    void read_loop() {
+        auto self = Ref{this};
+
+        auto work = io_ctx_->receive(socket_, std::span{read_buffer_.get(), fallback_buffer_size})
+            | stdexec::continues_on(strand_)
+            | stdexec::then([self](std::size_t n) {
+                if (n == 0) {
+                    std::cout << "[TCP:" << self->socket_.fd << "] Connection closed by peer\n";
+                    self->input_finished_ = true;
+                    self->process_next();
+                    return;
+                }
+
+                self->pending_.push_back(io::ProvidedBuffer::borrowed(std::span{self->read_buffer_.get(), n}));
+                self->process_next();
+            })
+            | stdexec::upon_error([self](std::exception_ptr e) {
+                try { std::rethrow_exception(e); }
+                catch (const std::exception& ex) {
+                    std::cout << "[TCP:" << self->socket_.fd << "] Error: " << ex.what() << "\n";
+                }
+                self->close();
+            })
+            | stdexec::upon_stopped([self] { self->close(); });
+
+        stdexec::start_detached(std::move(work));
+    }
+
+    // Runs on the strand with what the pipeline waits for after its latest output; a message that
+    // stays incomplete over several reads keeps the time its first bytes were processed
+    void expect(TcpInputState awaiting) {
+        if (awaiting == TcpInputState::header && awaiting_ != TcpInputState::header) {
+            message_started_ = io::IoUringContext::Clock::now();
+        }
+        awaiting_ = awaiting;
+    }
+
+    // Runs on the strand when the session goes back to waiting for its peer
+    void await_input() {
+        switch (awaiting_) {
+            case TcpInputState::idle:
+                set_deadline(timeouts_.idle);
+                break;
+            case TcpInputState::header:
+                if (timeouts_.header.count() > 0) set_deadline_at(message_started_ + timeouts_.header);
+                else clear_deadline();
+                break;
+            case TcpInputState::body:
+                set_deadline(timeouts_.body);
+                break;
+        }
+    }
+
+    void set_deadline(std::chrono::milliseconds timeout) {
+        if (timeout.count() > 0) set_deadline_at(io::IoUringContext::Clock::now() + timeout);
+        else clear_deadline();
+    }
+
+    // Moves the deadline; the wheel holds a reference until it fires or is cleared
+    void set_deadline_at(io::IoUringContext::Clock::time_point when) {
+        clear_deadline();
+        if (!is_active_) return;
+
+        add_ref();
+        if (auto generation = io_ctx_->add_timer(deadline_, when); generation != 0) {
+            deadline_generation_.store(generation, std::memory_order_release);
+        } else {
+            release();
+        }
+    }
+
+    void clear_deadline() {
+        if (io_ctx_->cancel_timer(deadline_)) release();
+    }
+
+    // Runs on the reactor thread; adopts the reference the deadline held
+    static void on_deadline(io::TimerNode* node, uint64_t generation, bool expired) noexcept {
+        auto self = Ref::adopt(static_cast<Deadline*>(node)->session);
+        if (!expired) return;
+
+        auto work = stdexec::schedule(self->strand_)
+            | stdexec::then([self, generation] { self->time_out(generation); });
+        stdexec::start_detached(std::move(work));
+    }
+
+    void time_out(uint64_t generation) {
+        if (generation != deadline_generation_.load(std::memory_order_acquire) || !is_active_) return;
+
+        std::cout << "[TCP:" << socket_.fd << "] Timed out\n";
+        // A write to a peer that stopped reading would otherwise never complete
+        io_ctx_->cancel(socket_);
+        close();
+    }
+
+    void close() {
+        if (!is_active_.exchange(false)) return;
+        clear_deadline();
+        if (receive_op_) receive_op_->cancel();
+        if (on_close_) on_close_(socket_.fd);
+    }
+};
+}
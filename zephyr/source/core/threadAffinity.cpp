@@ -0,0 +1,28 @@
+#include "zephyr/core/threadAffinity.hpp"
+
+#include <cstdint>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace zephyr::core
+{
+auto pinThread(std::thread::native_handle_type t_thread, uint32_t t_cpu) noexcept -> bool
+{
+    if (t_cpu >= CPU_SETSIZE) {
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(t_cpu, &set);
+
+    return pthread_setaffinity_np(t_thread, sizeof(set), &set) == 0;
+}
+
+auto pinCurrentThread(uint32_t t_cpu) noexcept -> bool
+{
+    return pinThread(pthread_self(), t_cpu);
+}
+}  // namespace zephyr::core
@@ -0,0 +1,120 @@
+#include "zephyr/http/details/chunkedDecoder.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+namespace zephyr::http::details
+{
+namespace
+{
+// Chunk size lines and trailer fields are short; anything longer is not a well-formed body
+constexpr std::size_t max_line = 1024;
+
+auto is_blank(char t_c) -> bool
+{
+    return t_c == ' ' || t_c == '\t';
+}
+}
+
+auto ChunkedDecoder::decode(std::string_view t_input, std::string& t_out)
+    -> ChunkedResult
+{
+    std::size_t position = 0;
+
+    while (m_state != State::complete && m_state != State::error) {
+        if (m_state == State::data) {
+            auto available = std::min(t_input.size() - position, m_remaining);
+            t_out.append(t_input.substr(position, available));
+            position += available;
+            m_remaining -= available;
+
+            if (m_remaining != 0) {
+                return {ChunkedStatus::incomplete, position};
+            }
+
+            m_state = State::data_end;
+            continue;
+        }
+
+        auto newline = t_input.find('\n', position);
+        if (newline == std::string_view::npos) {
+            m_line.append(t_input.substr(position));
+            if (m_line.size() > max_line) {
+                m_state = State::error;
+                break;
+            }
+            return {ChunkedStatus::incomplete, t_input.size()};
+        }
+
+        // Most lines arrive whole and are looked at in place
+        auto line = t_input.substr(position, newline - position);
+        if (!m_line.empty()) {
+            m_line.append(line);
+            line = m_line;
+        }
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        position = newline + 1;
+
+        if (line.size() > max_line || !end_line(line)) {
+            m_state = State::error;
+        }
+        m_line.clear();
+    }
+
+    if (m_state == State::error) {
+        return {ChunkedStatus::error, position};
+    }
+
+    return {ChunkedStatus::complete, position};
+}
+
+auto ChunkedDecoder::reset() noexcept
+    -> void
+{
+    m_state = State::size;
+    m_remaining = 0;
+    m_decoded = 0;
+    m_trailer_bytes = 0;
+    m_line.clear();
+}
+
+auto ChunkedDecoder::end_line(std::string_view t_line)
+    -> bool
+{
+    if (m_state == State::data_end) {
+        m_state = State::size;
+        return t_line.empty();
+    }
+
+    if (m_state == State::size) {
+        // Extensions after ';' carry nothing we use
+        auto digits = t_line.substr(0, t_line.find(';'));
+        while (!digits.empty() && is_blank(digits.back())) {
+            digits.remove_suffix(1);
+        }
+
+        std::size_t size = 0;
+        auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), size, 16);
+        if (digits.empty() || ec != std::errc{} || ptr != digits.data() + digits.size()
+            || size > m_max_body_bytes - m_decoded) {
+            return false;
+        }
+
+        m_decoded += size;
+        m_remaining = size;
+        m_state = size == 0 ? State::trailers : State::data;
+        return true;
+    }
+
+    // Trailer fields are read past and dropped
+    if (t_line.empty()) {
+        m_state = State::complete;
+        return true;
+    }
+
+    m_trailer_bytes += t_line.size() + 2;
+    return m_trailer_bytes <= m_max_trailer_bytes;
+}
+}
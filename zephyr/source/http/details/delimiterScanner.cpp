@@ -0,0 +1,194 @@
+#include "zephyr/http/details/delimiterScanner.hpp"
+
+#include <atomic>
+#include <bit>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ZEPHYR_SCANNER_X86 1
+#endif
+
+namespace zephyr::http::details
+{
+namespace
+{
+// Appends the delimiters flagged in t_mask (bit i set for offset t_base + i)
+struct Emitter
+{
+    std::span<uint32_t> out;
+    std::size_t count = 0;
+
+    // False once the output is full
+    auto emit(uint64_t t_mask, std::size_t t_base) noexcept -> bool
+    {
+        for (; t_mask != 0; t_mask &= t_mask - 1) {
+            if (count == out.size()) {
+                return false;
+            }
+            out[count++] = static_cast<uint32_t>(t_base + static_cast<std::size_t>(std::countr_zero(t_mask)));
+        }
+
+        return true;
+    }
+
+    auto full() const noexcept -> ScanResult
+    {
+        return {count, out[count - 1] + std::size_t{1}};
+    }
+
+    auto done(std::size_t t_scanned) const noexcept -> ScanResult
+    {
+        return {count, t_scanned};
+    }
+};
+
+// Inlined into the vector scanners for their tails, so none of them calls out with dirty YMM state
+[[gnu::always_inline]] inline auto scan_scalar(Emitter& t_emitter, const char* t_data, std::size_t t_from, std::size_t t_size, char t_a,
+                 char t_b) noexcept -> ScanResult
+{
+    for (auto i = t_from; i < t_size; ++i) {
+        if ((t_data[i] == t_a || t_data[i] == t_b) && !t_emitter.emit(1, i)) {
+            return t_emitter.full();
+        }
+    }
+
+    return t_emitter.done(t_size);
+}
+
+auto index_any_scalar(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                      std::span<uint32_t> t_out) noexcept -> ScanResult
+{
+    Emitter emitter{t_out};
+    return scan_scalar(emitter, t_data, t_from, t_size, t_a, t_b);
+}
+
+#ifdef ZEPHYR_SCANNER_X86
+// 16 bytes at a time. SSE2 is part of the x86-64 baseline, and a compare per delimiter plus movemask
+// beats pcmpestri for the two characters the parser looks for. Always inlined so the AVX2 scanner
+// gets the VEX encoding: running legacy SSE code with dirty upper YMM state costs more than the scan.
+__attribute__((target("sse2"), always_inline)) inline
+auto scan_sse2(Emitter& t_emitter, const char* t_data, std::size_t t_from, std::size_t t_size, char t_a,
+               char t_b) noexcept -> ScanResult
+{
+    const auto a = _mm_set1_epi8(t_a);
+    const auto b = _mm_set1_epi8(t_b);
+
+    auto block = [&](std::size_t t_offset) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t_data + t_offset));
+        const auto hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, a), _mm_cmpeq_epi8(chunk, b));
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(hits)));
+    };
+
+    auto i = t_from;
+    for (; i + 16 <= t_size; i += 16) {
+        if (!t_emitter.emit(block(i), i)) {
+            return t_emitter.full();
+        }
+    }
+
+    if (i == t_size) {
+        return t_emitter.done(t_size);
+    }
+
+    if (t_size < 16) {
+        return scan_scalar(t_emitter, t_data, i, t_size, t_a, t_b);
+    }
+
+    // Short tail: rescan the last full block and drop the bytes that were already checked
+    const auto last = t_size - 16;
+    if (!t_emitter.emit(block(last) >> (i - last), i)) {
+        return t_emitter.full();
+    }
+
+    return t_emitter.done(t_size);
+}
+
+auto index_any_sse2(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                    std::span<uint32_t> t_out) noexcept -> ScanResult
+{
+    Emitter emitter{t_out};
+    return scan_sse2(emitter, t_data, t_from, t_size, t_a, t_b);
+}
+
+__attribute__((target("avx2")))
+auto index_any_avx2(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                    std::span<uint32_t> t_out) noexcept -> ScanResult
+{
+    Emitter emitter{t_out};
+
+    auto i = t_from;
+    if (i + 32 <= t_size) {
+        const auto a = _mm256_set1_epi8(t_a);
+        const auto b = _mm256_set1_epi8(t_b);
+
+        for (; i + 32 <= t_size; i += 32) {
+            const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t_data + i));
+            const auto hits = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, a), _mm256_cmpeq_epi8(chunk, b));
+            if (!emitter.emit(static_cast<uint32_t>(_mm256_movemask_epi8(hits)), i)) {
+                return emitter.full();
+            }
+        }
+    }
+
+    // Header lines are often shorter than 32 bytes; finish 16 at a time
+    return scan_sse2(emitter, t_data, i, t_size, t_a, t_b);
+}
+#endif
+
+auto select_and_index(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                      std::span<uint32_t> t_out) noexcept -> ScanResult;
+
+// Starts out pointing at the selector, which swaps in the best scanner on first use
+std::atomic<IndexAnyFn> g_index_any{&select_and_index};
+
+auto select_and_index(const char* t_data, std::size_t t_from, std::size_t t_size, char t_a, char t_b,
+                      std::span<uint32_t> t_out) noexcept -> ScanResult
+{
+    auto best = scanner_for(best_scanner());
+    g_index_any.store(best, std::memory_order_relaxed);
+    return best(t_data, t_from, t_size, t_a, t_b, t_out);
+}
+}
+
+auto scanner_for(ScannerKind t_kind) noexcept
+    -> IndexAnyFn
+{
+    switch (t_kind) {
+    case ScannerKind::scalar:
+        return &index_any_scalar;
+#ifdef ZEPHYR_SCANNER_X86
+    case ScannerKind::sse2:
+        return __builtin_cpu_supports("sse2") ? &index_any_sse2 : nullptr;
+    case ScannerKind::avx2:
+        return __builtin_cpu_supports("avx2") ? &index_any_avx2 : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+auto best_scanner() noexcept
+    -> ScannerKind
+{
+    static const auto best = [] {
+        for (auto kind : {ScannerKind::avx2, ScannerKind::sse2}) {
+            if (scanner_for(kind) != nullptr) {
+                return kind;
+            }
+        }
+        return ScannerKind::scalar;
+    }();
+
+    return best;
+}
+
+auto index_any(std::string_view t_data, std::size_t t_from, char t_a, char t_b, std::span<uint32_t> t_out) noexcept
+    -> ScanResult
+{
+    if (t_from >= t_data.size() || t_out.empty()) {
+        return {0, t_from};
+    }
+
+    return g_index_any.load(std::memory_order_relaxed)(t_data.data(), t_from, t_data.size(), t_a, t_b, t_out);
+}
+}
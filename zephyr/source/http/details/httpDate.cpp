@@ -0,0 +1,63 @@
+#include "zephyr/http/details/httpDate.hpp"
+
+#include <time.h>
+
+namespace zephyr::http::details
+{
+namespace
+{
+constexpr std::string_view DAYS = "SunMonTueWedThuFriSat";
+constexpr std::string_view MONTHS = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+auto put_two_digits(char* t_out, int t_value) noexcept
+    -> void
+{
+    t_out[0] = static_cast<char>('0' + t_value / 10);
+    t_out[1] = static_cast<char>('0' + t_value % 10);
+}
+}
+
+auto format_http_date(std::time_t t_time, char (&t_out)[http_date_size]) noexcept
+    -> void
+{
+    std::tm parts{};
+    gmtime_r(&t_time, &parts);
+
+    DAYS.copy(t_out, 3, static_cast<std::size_t>(parts.tm_wday) * 3);
+    t_out[3] = ',';
+    t_out[4] = ' ';
+    put_two_digits(t_out + 5, parts.tm_mday);
+    t_out[7] = ' ';
+    MONTHS.copy(t_out + 8, 3, static_cast<std::size_t>(parts.tm_mon) * 3);
+    t_out[11] = ' ';
+
+    const auto year = parts.tm_year + 1900;
+    put_two_digits(t_out + 12, year / 100 % 100);
+    put_two_digits(t_out + 14, year % 100);
+    t_out[16] = ' ';
+    put_two_digits(t_out + 17, parts.tm_hour);
+    t_out[19] = ':';
+    put_two_digits(t_out + 20, parts.tm_min);
+    t_out[22] = ':';
+    put_two_digits(t_out + 23, parts.tm_sec);
+    std::string_view{" GMT"}.copy(t_out + 25, 4);
+}
+
+auto cached_http_date() noexcept
+    -> std::string_view
+{
+    thread_local std::time_t cached_second = -1;
+    thread_local char cached[http_date_size];
+
+    // The coarse clock is read from the vDSO without a syscall and is precise enough for seconds
+    timespec now{};
+    clock_gettime(CLOCK_REALTIME_COARSE, &now);
+
+    if (now.tv_sec != cached_second) {
+        format_http_date(now.tv_sec, cached);
+        cached_second = now.tv_sec;
+    }
+
+    return {cached, http_date_size};
+}
+}
@@ -0,0 +1,154 @@
+#include "zephyr/http/details/openFileCache.hpp"
+
+#include "zephyr/http/details/httpDate.hpp"
+
+#include <charconv>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace zephyr::http::details
+{
+namespace
+{
+auto same_file(const OpenFile& t_file, const struct stat& t_stat) -> bool
+{
+    return t_file.device == t_stat.st_dev && t_file.inode == t_stat.st_ino
+        && t_file.size == static_cast<uint64_t>(t_stat.st_size) && t_file.modified.tv_sec == t_stat.st_mtim.tv_sec
+        && t_file.modified.tv_nsec == t_stat.st_mtim.tv_nsec;
+}
+
+// "<size>-<mtime in ns>" in hex; changes whenever the content may have
+auto make_etag(uint64_t t_size, std::timespec t_modified) -> std::string
+{
+    const auto nanoseconds = static_cast<uint64_t>(t_modified.tv_sec) * 1'000'000'000ULL
+                           + static_cast<uint64_t>(t_modified.tv_nsec);
+
+    // Quotes, dash and two 64-bit values of at most 16 hex digits each
+    char text[35];
+    text[0] = '"';
+    char* end = std::to_chars(text + 1, text + 17, t_size, 16).ptr;
+    *end++ = '-';
+    end = std::to_chars(end, end + 16, nanoseconds, 16).ptr;
+    *end++ = '"';
+    return {text, end};
+}
+
+auto open_file(const std::string& t_path) -> std::shared_ptr<const OpenFile>
+{
+    const int fd = ::open(t_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    auto file = std::make_shared<OpenFile>();
+    file->fd = fd;
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        return nullptr;
+    }
+
+    file->size = static_cast<uint64_t>(info.st_size);
+    file->modified = info.st_mtim;
+    file->device = info.st_dev;
+    file->inode = info.st_ino;
+    file->etag = make_etag(file->size, file->modified);
+
+    char date[http_date_size];
+    format_http_date(info.st_mtim.tv_sec, date);
+    file->last_modified.assign(date, http_date_size);
+
+    return file;
+}
+}
+
+OpenFile::~OpenFile()
+{
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+auto OpenFileCache::open(const std::string& t_path)
+    -> std::shared_ptr<const OpenFile>
+{
+    const auto now = Clock::now();
+    std::shared_ptr<const OpenFile> cached;
+
+    {
+        std::lock_guard lock(m_mutex);
+        if (auto it = m_entries.find(t_path); it != m_entries.end()) {
+            m_order.splice(m_order.begin(), m_order, it->second.position);
+            if (now - it->second.checked < m_revalidate_after) {
+                return it->second.file;
+            }
+            cached = it->second.file;
+        }
+    }
+
+    // The file system is asked without holding the lock
+    if (cached) {
+        struct stat info{};
+        if (::stat(t_path.c_str(), &info) == 0 && same_file(*cached, info)) {
+            std::lock_guard lock(m_mutex);
+            if (auto it = m_entries.find(t_path); it != m_entries.end() && it->second.file == cached) {
+                it->second.checked = now;
+            }
+            return cached;
+        }
+    }
+
+    auto file = open_file(t_path);
+
+    std::lock_guard lock(m_mutex);
+    if (file) {
+        insert(t_path, file, now);
+    } else {
+        erase(t_path);
+    }
+
+    return file;
+}
+
+auto OpenFileCache::size() const
+    -> std::size_t
+{
+    std::lock_guard lock(m_mutex);
+    return m_entries.size();
+}
+
+auto OpenFileCache::insert(const std::string& t_path, std::shared_ptr<const OpenFile> t_file, Clock::time_point t_now)
+    -> void
+{
+    if (m_capacity == 0) {
+        return;
+    }
+
+    if (auto it = m_entries.find(t_path); it != m_entries.end()) {
+        it->second.file = std::move(t_file);
+        it->second.checked = t_now;
+        m_order.splice(m_order.begin(), m_order, it->second.position);
+        return;
+    }
+
+    if (m_entries.size() == m_capacity) {
+        m_entries.erase(m_order.back());
+        m_order.pop_back();
+    }
+
+    m_order.push_front(t_path);
+    m_entries.emplace(t_path, Entry{std::move(t_file), t_now, m_order.begin()});
+}
+
+auto OpenFileCache::erase(const std::string& t_path)
+    -> void
+{
+    if (auto it = m_entries.find(t_path); it != m_entries.end()) {
+        m_order.erase(it->second.position);
+        m_entries.erase(it);
+    }
+}
+}
@@ -0,0 +1,152 @@
+#include "zephyr/http/details/radixTree.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace zephyr::http::details
+{
+namespace
+{
+auto add_route(std::vector<std::pair<std::string, std::size_t>>& t_routes, std::string_view t_method,
+               std::size_t t_route) -> void
+{
+    auto registered = std::ranges::any_of(t_routes, [&](const auto& r) { return r.first == t_method; });
+    if (!registered) {
+        t_routes.emplace_back(t_method, t_route);
+    }
+}
+}
+
+auto RadixTree::Node::route_for(std::string_view t_method) const noexcept
+    -> const std::size_t*
+{
+    const std::size_t* any = nullptr;
+
+    for (const auto& [method, route] : routes) {
+        if (method == t_method) {
+            return &route;
+        }
+        if (method == "*") {
+            any = &route;
+        }
+    }
+
+    return any;
+}
+
+auto RadixTree::insert(std::string_view t_method, std::string_view t_pattern, std::size_t t_route)
+    -> void
+{
+    insert(m_root, t_method, t_pattern, t_route, 0);
+}
+
+auto RadixTree::find(std::string_view t_method, std::string_view t_path, RouteMatch& t_match) const noexcept
+    -> bool
+{
+    t_match.param_count = 0;
+    return find(m_root, t_method, t_path, t_match);
+}
+
+auto RadixTree::insert(Node& t_node, std::string_view t_method, std::string_view t_pattern, std::size_t t_route,
+                       std::size_t t_params) -> void
+{
+    if (t_pattern.empty()) {
+        add_route(t_node.routes, t_method, t_route);
+        return;
+    }
+
+    if (t_pattern.front() == '*') {
+        if (t_pattern.size() != 1) {
+            throw std::invalid_argument("'*' is only supported at the end of a route pattern");
+        }
+
+        if (!t_node.wildcard_child) {
+            t_node.wildcard_child = std::make_unique<Node>();
+        }
+        add_route(t_node.wildcard_child->routes, t_method, t_route);
+        return;
+    }
+
+    if (t_pattern.front() == ':') {
+        if (t_params == RouteMatch::max_params) {
+            throw std::invalid_argument("too many parameters in route pattern");
+        }
+
+        if (!t_node.param_child) {
+            t_node.param_child = std::make_unique<Node>();
+        }
+
+        auto name_end = std::min(t_pattern.find('/'), t_pattern.size());
+        insert(*t_node.param_child, t_method, t_pattern.substr(name_end), t_route, t_params + 1);
+        return;
+    }
+
+    auto text = t_pattern.substr(0, std::min(t_pattern.find_first_of(":*"), t_pattern.size()));
+
+    auto it = std::ranges::find_if(t_node.children, [&](const auto& c) { return c->prefix.front() == text.front(); });
+    if (it == t_node.children.end()) {
+        auto& child = t_node.children.emplace_back(std::make_unique<Node>());
+        child->prefix = text;
+        insert(*child, t_method, t_pattern.substr(text.size()), t_route, t_params);
+        return;
+    }
+
+    auto& child = *it;
+    auto common = static_cast<std::size_t>(std::ranges::mismatch(child->prefix, text).in1 - child->prefix.begin());
+
+    if (common < child->prefix.size()) {
+        // Split the edge: the shared part becomes a new node that owns the old child
+        auto split = std::make_unique<Node>();
+        split->prefix = child->prefix.substr(0, common);
+        child->prefix.erase(0, common);
+        split->children.push_back(std::move(child));
+        child = std::move(split);
+    }
+
+    insert(*child, t_method, t_pattern.substr(common), t_route, t_params);
+}
+
+auto RadixTree::find(const Node& t_node, std::string_view t_method, std::string_view t_path,
+                     RouteMatch& t_match) noexcept -> bool
+{
+    if (t_path.empty()) {
+        if (const auto* route = t_node.route_for(t_method)) {
+            t_match.route = *route;
+            return true;
+        }
+    } else {
+        for (const auto& child : t_node.children) {
+            if (child->prefix.front() == t_path.front()) {
+                if (t_path.starts_with(child->prefix)
+                    && find(*child, t_method, t_path.substr(child->prefix.size()), t_match)) {
+                    return true;
+                }
+                // Children never share a first character, so no other static edge can match
+                break;
+            }
+        }
+
+        if (t_node.param_child) {
+            auto segment = t_path.substr(0, std::min(t_path.find('/'), t_path.size()));
+            auto saved = t_match.param_count;
+
+            if (!segment.empty()) {
+                t_match.param_storage[t_match.param_count++] = segment;
+                if (find(*t_node.param_child, t_method, t_path.substr(segment.size()), t_match)) {
+                    return true;
+                }
+                t_match.param_count = saved;
+            }
+        }
+    }
+
+    if (t_node.wildcard_child) {
+        if (const auto* route = t_node.wildcard_child->route_for(t_method)) {
+            t_match.route = *route;
+            return true;
+        }
+    }
+
+    return false;
+}
+}
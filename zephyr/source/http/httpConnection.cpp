@@ -0,0 +1,292 @@
+#include "zephyr/http/httpConnection.hpp"
+
+#include <stdexec/execution.hpp>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "zephyr/common/callbackSender.hpp"
+#include "zephyr/http/httpHeaders.hpp"
+#include "zephyr/http/httpSerializer.hpp"
+#include "zephyr/io/gatherBuffer.hpp"
+
+namespace zephyr::http
+{
+namespace
+{
+// A response body written after its head, from a producer or a file, and the responses pipelined
+// behind it, which wait until it is out
+struct PendingBody
+{
+    std::shared_ptr<HttpBodyProducer> producer;
+    bool chunked = true;
+    io::GatherBuffer after;
+    std::optional<io::FileRegion> file;
+};
+
+struct ConnectionOutput
+{
+    io::GatherBuffer data;
+    std::deque<PendingBody> bodies;
+    bool close_after = false;
+
+    auto add(HttpResponse t_response, std::string_view t_connection, bool t_http10)
+        -> void
+    {
+        // A body delimited by the end of the connection is the last thing written to it
+        if (close_after) {
+            return;
+        }
+
+        if (!t_connection.empty()) {
+            t_response.headers.insert_or_assign(std::string{headers::connection}, std::string{t_connection});
+        }
+
+        auto& tail = bodies.empty() ? data : bodies.back().after;
+        if (t_response.file_body) {
+            auto file = std::move(t_response.file_body);
+            tail.append(HttpSerializer::serialize_head(t_response, false));
+            bodies.push_back({.chunked = false, .file = std::move(file)});
+            return;
+        }
+
+        if (!t_response.body_producer) {
+            tail.append(HttpSerializer::serialize_vectored(std::move(t_response)));
+            return;
+        }
+
+        // HTTP/1.0 has no chunked framing, so a body of unknown length ends with the connection
+        const auto has_length = t_response.headers.contains(headers::content_length);
+        if (!has_length && t_http10) {
+            t_response.headers.insert_or_assign(std::string{headers::connection}, "close");
+            close_after = true;
+        }
+
+        const auto chunked = !has_length && !t_http10;
+        tail.append(HttpSerializer::serialize_head(t_response, chunked));
+        bodies.push_back({std::move(t_response.body_producer), chunked, {}});
+    }
+};
+
+using OutputSender = common::ResultSender<ConnectionOutput>;
+
+// Writes the pending bodies in order, framing every produced piece; runs dry after the last one
+auto body_writer(std::shared_ptr<std::deque<PendingBody>> t_bodies)
+    -> tcp::TcpOutput::Producer
+{
+    using Piece = std::optional<tcp::TcpOutput::Piece>;
+
+    return [t_bodies]() -> common::ResultSender<Piece> {
+        if (t_bodies->empty()) {
+            return {stdexec::just(Piece{})};
+        }
+
+        auto& pending = t_bodies->front();
+        if (pending.file) {
+            auto region = std::move(*pending.file);
+            pending.file.reset();
+            return {stdexec::just(Piece{std::move(region)})};
+        }
+
+        if (!pending.producer) {
+            auto after = std::move(pending.after);
+            t_bodies->pop_front();
+            return {stdexec::just(Piece{std::move(after)})};
+        }
+
+        return {pending.producer->next()
+            | stdexec::then([t_bodies](BodyChunk t_chunk) -> Piece {
+                auto& body = t_bodies->front();
+                if (t_chunk) {
+                    return body.chunked ? HttpSerializer::chunk(std::move(*t_chunk)) : io::GatherBuffer{std::move(*t_chunk)};
+                }
+
+                io::GatherBuffer out;
+                if (body.chunked) {
+                    out.append_static(HttpSerializer::last_chunk);
+                }
+                out.append(std::move(body.after));
+                t_bodies->pop_front();
+                return out;
+            })};
+    };
+}
+
+// Completes once t_chunk is off the connection's hands: taken by the handler, or dropped because
+// the handler has already responded
+auto hand_over(std::shared_ptr<BodyChannel> t_body, BodyChunk t_chunk)
+    -> common::ResultSender<std::size_t>
+{
+    return common::ResultSender<std::size_t>{
+        common::from_callback<std::size_t>([t_body, chunk = std::move(t_chunk)](common::Completion<std::size_t> t_done) mutable {
+            const auto size = chunk ? chunk->size() : 0;
+            t_body->push(std::move(chunk), [t_done = std::move(t_done), size] { t_done(nullptr, size); });
+        })
+    };
+}
+}
+
+HttpConnection::HttpConnection(const HttpRouter& t_router)
+    : m_stream({}, [&t_router](const HttpRequestView& t_request) {
+          return t_router.streams_body(t_request.method, t_request.path);
+      }) {}
+
+HttpConnection::~HttpConnection()
+{
+    if (m_streamed.body) {
+        m_streamed.body->fail(std::make_exception_ptr(std::runtime_error("connection closed")));
+    }
+}
+
+auto HttpConnection::operator()(std::string_view t_data, const Handler& t_handler)
+    -> tcp::TcpProtocol::ResultSenderType
+{
+    m_items.clear();
+    auto status = m_stream.feed(t_data, m_items);
+
+    if (m_items.empty() && status == HttpStreamStatus::open) {
+        return {stdexec::just(tcp::TcpProtocol::OutputType(std::nullopt))};
+    }
+
+    // Everything runs one after another so responses go out in arrival order, in a single write
+    auto output = OutputSender{stdexec::just(ConnectionOutput{})};
+
+    for (auto& item : m_items) {
+        if (auto* piece = std::get_if<BodyPiece>(&item)) {
+            auto last = piece->last;
+            output = OutputSender{
+                std::move(output)
+                | stdexec::let_value([streamed = m_streamed, piece = std::move(*piece)](ConnectionOutput& t_out) mutable {
+                    auto handed = common::ResultSender<std::size_t>{stdexec::just(std::size_t{0})};
+                    if (!piece.data.empty()) {
+                        handed = hand_over(streamed.body, std::move(piece.data));
+                    }
+
+                    if (!piece.last) {
+                        return OutputSender{std::move(handed) | stdexec::then([&t_out](std::size_t) { return std::move(t_out); })};
+                    }
+
+                    // The end of the body goes through the channel like any piece, then the response is awaited
+                    return OutputSender{
+                        std::move(handed)
+                        | stdexec::let_value([body = streamed.body](std::size_t) { return hand_over(body, std::nullopt); })
+                        | stdexec::let_value([response = streamed.response](std::size_t) {
+                            return common::from_callback<HttpResponse>([response](common::Completion<HttpResponse> t_done) {
+                                response->pull(std::move(t_done));
+                            });
+                        })
+                        | stdexec::then([&t_out, streamed](HttpResponse t_response) {
+                            t_out.add(std::move(t_response), streamed.connection, streamed.http10);
+                            return std::move(t_out);
+                        })
+                    };
+                })
+            };
+
+            if (last) {
+                m_streamed = {};
+            }
+            continue;
+        }
+
+        auto& framed = std::get<FramedRequest>(item);
+        std::cout << "[HTTP] " << framed.request.method << " " << framed.request.path << "\n";
+
+        auto connection = connection_header(framed);
+        auto http10 = framed.request.version == "HTTP/1.0";
+
+        if (framed.streams_body) {
+            m_streamed.connection = connection;
+            m_streamed.http10 = http10;
+            start_streamed(std::move(framed.request), t_handler);
+            continue;
+        }
+
+        output = OutputSender{
+            std::move(output)
+            | stdexec::let_value([t_handler, connection, http10, request = std::move(framed.request)](ConnectionOutput& t_out) mutable {
+                return t_handler(std::move(request))
+                    | stdexec::then([&t_out, connection, http10](HttpResponse t_response) {
+                        t_out.add(std::move(t_response), connection, http10);
+                        return std::move(t_out);
+                    });
+            })
+        };
+    }
+
+    if (status == HttpStreamStatus::error) {
+        if (m_streamed.body) {
+            m_streamed.body->fail(std::make_exception_ptr(std::runtime_error("malformed request body")));
+            m_streamed = {};
+        }
+
+        HttpResponse error_response{};
+        error_response.status_code = 400;
+        error_response.status_text = "Bad Request";
+        error_response.body = "Failed to parse HTTP request";
+
+        output = OutputSender{
+            std::move(output)
+            | stdexec::then([error_response = std::move(error_response)](ConnectionOutput t_out) mutable {
+                t_out.add(std::move(error_response), "close", false);
+                return t_out;
+            })
+        };
+    }
+
+    // What the session waits for next: more of the body being streamed, the rest of a request
+    // whose start is buffered, or a new request
+    auto awaiting = tcp::TcpInputState::idle;
+    if (m_stream.streaming()) {
+        awaiting = tcp::TcpInputState::body;
+    } else if (m_stream.buffered() != 0) {
+        awaiting = tcp::TcpInputState::header;
+    }
+
+    return {
+        std::move(output)
+        | stdexec::then([close_after = status != HttpStreamStatus::open, awaiting](ConnectionOutput t_out)
+            -> tcp::TcpProtocol::OutputType {
+            tcp::TcpOutput::Producer next;
+            if (!t_out.bodies.empty()) {
+                next = body_writer(std::make_shared<std::deque<PendingBody>>(std::move(t_out.bodies)));
+            }
+            tcp::TcpOutput result{std::move(t_out.data), close_after || t_out.close_after, std::move(next)};
+            result.awaiting = awaiting;
+            return result;
+        })
+    };
+}
+
+auto HttpConnection::start_streamed(HttpRequest t_request, const Handler& t_handler)
+    -> void
+{
+    auto body = std::make_shared<BodyChannel>();
+    auto response = std::make_shared<common::Rendezvous<HttpResponse>>();
+    m_streamed.body = body;
+    m_streamed.response = response;
+    t_request.body_stream = std::make_shared<HttpBodyReader>(body);
+
+    // The handler runs alongside the upload; what it has not read when it responds is dropped
+    stdexec::start_detached(
+        t_handler(std::move(t_request))
+        | stdexec::then([body, response](HttpResponse t_response) {
+            body->abandon();
+            response->push(std::move(t_response), nullptr);
+        })
+        | stdexec::upon_error([body, response](std::exception_ptr t_error) {
+            body->abandon();
+            response->fail(t_error);
+        })
+        | stdexec::upon_stopped([body, response] {
+            body->abandon();
+            response->fail(std::make_exception_ptr(std::runtime_error("request handler stopped")));
+        }));
+}
+}
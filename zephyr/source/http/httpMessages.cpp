@@ -1,5 +1,7 @@
 #include "zephyr/http/httpMessages.hpp"
 
+#include "zephyr/http/httpHeaders.hpp"
+
 namespace zephyr::http
 {
 auto HttpResponse::ok(std::string t_body_text) ->HttpResponse
@@ -12,7 +14,7 @@ auto HttpResponse::ok(std::string t_body_text) ->HttpResponse
 auto HttpResponse::json(std::string t_json_text) -> HttpResponse
 {
     HttpResponse r;
-    r.headers["Content-Type"] = "application/json";
+    r.headers.emplace(headers::content_type, "application/json");
     r.body = std::move(t_json_text);
     return r;
 }
@@ -0,0 +1,285 @@
+#include "zephyr/http/httpParser.hpp"
+
+#include "zephyr/http/details/delimiterScanner.hpp"
+#include "zephyr/http/httpHeaders.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <utility>
+
+namespace zephyr::http
+{
+namespace
+{
+auto lower(char t_c) -> char
+{
+    return (t_c >= 'A' && t_c <= 'Z') ? static_cast<char>(t_c - 'A' + 'a') : t_c;
+}
+
+auto iequals(std::string_view t_a, std::string_view t_b) -> bool
+{
+    return t_a.size() == t_b.size()
+        && std::ranges::equal(t_a, t_b, [](char a, char b) { return lower(a) == lower(b); });
+}
+
+auto is_blank(char t_c) -> bool
+{
+    return t_c == ' ' || t_c == '\t';
+}
+}
+
+auto HttpParser::feed(std::string_view t_buffer)
+    -> HttpParseStatus
+{
+    if (auto status = feed_headers(t_buffer); status != HttpParseStatus::complete) {
+        return status;
+    }
+
+    if (m_state == State::body) {
+        if (m_content_length > m_limits.max_body_bytes) {
+            return fail();
+        }
+
+        if (m_chunked) {
+            m_position = m_body_offset;
+            m_state = State::chunked_body;
+        } else if (t_buffer.size() - m_body_offset < m_content_length) {
+            return HttpParseStatus::incomplete;
+        } else {
+            m_message_end = m_body_offset + m_content_length;
+            m_state = State::complete;
+        }
+    }
+
+    if (m_state == State::chunked_body) {
+        // The decoder keeps a partial line itself, so every byte after m_position is new to it
+        auto [status, consumed] = m_chunked_decoder.decode(t_buffer.substr(m_position), m_chunked_body);
+        m_position += consumed;
+
+        if (status == details::ChunkedStatus::error) {
+            return fail();
+        }
+        if (status == details::ChunkedStatus::incomplete) {
+            return HttpParseStatus::incomplete;
+        }
+
+        m_message_end = m_position;
+        m_state = State::complete;
+    }
+
+    publish(t_buffer, m_chunked ? std::string_view{m_chunked_body} : t_buffer.substr(m_body_offset, m_content_length));
+    return HttpParseStatus::complete;
+}
+
+auto HttpParser::feed_head(std::string_view t_buffer)
+    -> HttpParseStatus
+{
+    auto status = feed_headers(t_buffer);
+    if (status == HttpParseStatus::complete) {
+        publish(t_buffer, {});
+    }
+
+    return status;
+}
+
+auto HttpParser::reset() noexcept
+    -> void
+{
+    m_state = State::request_line;
+    m_position = 0;
+    m_scanned = 0;
+    m_colon = std::string_view::npos;
+    m_body_offset = 0;
+    m_content_length = 0;
+    m_message_end = 0;
+    m_has_content_length = false;
+    m_chunked = false;
+    m_chunked_decoder.reset();
+    m_chunked_body.clear();
+    m_header_count = 0;
+    m_request.header_count = 0;
+}
+
+auto HttpParser::parse(std::string_view t_raw)
+    -> std::optional<HttpRequest>
+{
+    HttpParser parser;
+    if (parser.feed(t_raw) != HttpParseStatus::complete) {
+        return std::nullopt;
+    }
+
+    return parser.request().to_request();
+}
+
+auto HttpParser::end_line(std::string_view t_buffer, std::size_t t_newline)
+    -> bool
+{
+    auto line_offset = m_position;
+    auto line_end = t_newline;
+    if (line_end > line_offset && t_buffer[line_end - 1] == '\r') {
+        --line_end;
+    }
+
+    auto line = t_buffer.substr(line_offset, line_end - line_offset);
+    m_position = t_newline + 1;
+
+    if (m_state == State::request_line) {
+        // Empty lines before the request line are allowed (RFC 9112, 2.2)
+        if (line.empty()) {
+            return true;
+        }
+
+        m_state = State::headers;
+        return parse_request_line(line, line_offset);
+    }
+
+    if (line.empty()) {
+        m_body_offset = m_position;
+        m_state = State::body;
+        return true;
+    }
+
+    return parse_header_line(line, line_offset, std::exchange(m_colon, std::string_view::npos));
+}
+
+auto HttpParser::parse_request_line(std::string_view t_line, std::size_t t_offset)
+    -> bool
+{
+    // Neither the method nor the target may contain a space, so the first two separate all three parts
+    std::array<uint32_t, 2> spaces{};
+    if (details::index_any(t_line, 0, ' ', ' ', spaces).count != spaces.size()) {
+        return false;
+    }
+
+    std::size_t method_end = spaces[0];
+    std::size_t path_start = method_end + 1;
+    std::size_t path_end = spaces[1];
+    if (method_end == 0 || path_end == path_start) {
+        return false;
+    }
+
+    auto version = t_line.substr(path_end + 1);
+    if (!version.starts_with("HTTP/")) {
+        return false;
+    }
+
+    m_method = {t_offset, method_end};
+    m_path = {t_offset + path_start, path_end - path_start};
+    m_version = {t_offset + path_end + 1, version.size()};
+    return true;
+}
+
+auto HttpParser::parse_header_line(std::string_view t_line, std::size_t t_offset, std::size_t t_colon)
+    -> bool
+{
+    auto colon = t_colon == std::string_view::npos ? t_colon : t_colon - t_offset;
+    if (colon == std::string_view::npos || colon == 0 || m_header_count == HttpRequestView::max_headers) {
+        return false;
+    }
+
+    // Whitespace inside or before the name is not allowed, which also rejects obsolete line folding
+    auto name = t_line.substr(0, colon);
+    if (std::ranges::any_of(name, is_blank)) {
+        return false;
+    }
+
+    auto value_start = colon + 1;
+    auto value_end = t_line.size();
+    while (value_start < value_end && is_blank(t_line[value_start])) {
+        ++value_start;
+    }
+    while (value_end > value_start && is_blank(t_line[value_end - 1])) {
+        --value_end;
+    }
+
+    auto value = t_line.substr(value_start, value_end - value_start);
+
+    if (iequals(name, headers::content_length)) {
+        std::size_t length = 0;
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), length);
+        if (ec != std::errc{} || ptr != value.data() + value.size() || value.empty()) {
+            return false;
+        }
+        // The body limit is checked once the headers are done, since feed_head() does not apply it
+        if ((m_has_content_length && length != m_content_length) || m_chunked) {
+            return false;
+        }
+
+        m_content_length = length;
+        m_has_content_length = true;
+    } else if (iequals(name, headers::transfer_encoding)) {
+        // Only plain chunked framing is decoded. A length next to it could be read differently by
+        // an intermediary, so that is refused as well (RFC 9112, 6.3).
+        if (!iequals(value, "chunked") || m_chunked || m_has_content_length) {
+            return false;
+        }
+
+        m_chunked = true;
+    }
+
+    m_headers[m_header_count++] = {Token{t_offset, colon}, Token{t_offset + value_start, value.size()}};
+    return true;
+}
+
+auto HttpParser::feed_headers(std::string_view t_buffer)
+    -> HttpParseStatus
+{
+    if (m_state == State::error) {
+        return HttpParseStatus::error;
+    }
+
+    // The scanner indexes every line end and colon of the header section in one vectorized pass;
+    // the lines are then cut at those offsets without looking at their bytes again
+    auto header_section = t_buffer.substr(0, std::min(t_buffer.size(), m_limits.max_header_bytes));
+    std::array<uint32_t, 64> delimiters;
+
+    while (m_state == State::request_line || m_state == State::headers) {
+        auto [count, scanned] = details::index_any(header_section, m_scanned, ':', '\n', delimiters);
+        m_scanned = scanned;
+
+        for (std::size_t i = 0; i < count && m_state != State::body; ++i) {
+            auto offset = delimiters[i];
+
+            if (t_buffer[offset] == ':') {
+                if (m_state == State::headers && m_colon == std::string_view::npos) {
+                    m_colon = offset;
+                }
+            } else if (!end_line(t_buffer, offset)) {
+                return fail();
+            }
+        }
+
+        if (count < delimiters.size() && m_state != State::body) {
+            if (t_buffer.size() > m_limits.max_header_bytes) {
+                return fail();
+            }
+
+            return HttpParseStatus::incomplete;
+        }
+    }
+
+    return HttpParseStatus::complete;
+}
+
+auto HttpParser::fail()
+    -> HttpParseStatus
+{
+    m_state = State::error;
+    return HttpParseStatus::error;
+}
+
+auto HttpParser::publish(std::string_view t_buffer, std::string_view t_body)
+    -> void
+{
+    m_request.method = m_method.in(t_buffer);
+    m_request.path = m_path.in(t_buffer);
+    m_request.version = m_version.in(t_buffer);
+    m_request.body = t_body;
+
+    for (std::size_t i = 0; i < m_header_count; ++i) {
+        m_request.header_storage[i] = {m_headers[i][0].in(t_buffer), m_headers[i][1].in(t_buffer)};
+    }
+    m_request.header_count = m_header_count;
+}
+}
@@ -0,0 +1,20 @@
+#include "zephyr/http/httpPipeline.hpp"
+
+#include <utility>
+
+#include "zephyr/http/httpMessages.hpp"
+
+namespace zephyr::http
+{
+HttpPipeline::HttpPipeline(const HttpRouter& t_router)
+        : m_router(t_router), m_connection(t_router) {}
+
+auto HttpPipeline::operator()(tcp::TcpProtocol::InputType t_data, std::shared_ptr<context::Context>)
+    -> tcp::TcpProtocol::ResultSenderType
+{
+    // The router outlives every session, so the handler may run after this pipeline has moved
+    return m_connection(t_data.view(), [&router = m_router](HttpRequest t_request) {
+        return router.route(std::move(t_request));
+    });
+}
+}
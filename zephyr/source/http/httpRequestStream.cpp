@@ -0,0 +1,141 @@
+#include "zephyr/http/httpRequestStream.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace zephyr::http
+{
+auto connection_header(const FramedRequest& t_request) noexcept
+    -> std::string_view
+{
+    if (!t_request.keep_alive) {
+        return "close";
+    }
+
+    return t_request.request.version == "HTTP/1.0" ? "keep-alive" : "";
+}
+
+auto HttpRequestStream::feed(std::string_view t_data, std::vector<HttpStreamItem>& t_items)
+    -> HttpStreamStatus
+{
+    if (m_status != HttpStreamStatus::open) {
+        return m_status;
+    }
+
+    auto buffered = !m_buffer.empty();
+    if (buffered) {
+        m_buffer += t_data;
+    }
+
+    std::string_view pending = buffered ? std::string_view{m_buffer} : t_data;
+
+    while (!pending.empty() && m_status == HttpStreamStatus::open) {
+        if (m_streaming) {
+            pending = feed_body(pending, t_items);
+            continue;
+        }
+
+        // With a predicate the headers are parsed first, so a streamed body is never buffered
+        auto offer = m_streams_body && !m_buffers_body;
+        auto status = offer ? m_parser.feed_head(pending) : m_parser.feed(pending);
+
+        auto streams = false;
+        if (status == HttpParseStatus::complete && offer) {
+            streams = m_streams_body(m_parser.request());
+            if (!streams) {
+                m_buffers_body = true;
+                status = m_parser.feed(pending);
+            }
+        }
+
+        if (status == HttpParseStatus::incomplete) {
+            break;
+        }
+
+        if (status == HttpParseStatus::error) {
+            m_status = HttpStreamStatus::error;
+            break;
+        }
+
+        const auto& view = m_parser.request();
+        auto keep_alive = view.keep_alive();
+        t_items.emplace_back(FramedRequest{view.to_request(), keep_alive, streams});
+        m_buffers_body = false;
+
+        if (streams) {
+            m_streaming = true;
+            m_keep_alive_after_body = keep_alive;
+            m_chunked = m_parser.is_chunked();
+            m_body_remaining = m_parser.content_length();
+            m_chunked_decoder.reset();
+
+            pending.remove_prefix(m_parser.body_offset());
+            m_parser.reset();
+
+            // An empty body still gets its last piece, so the handler sees it end
+            if (!m_chunked && m_body_remaining == 0) {
+                pending = feed_body(pending, t_items);
+            }
+            continue;
+        }
+
+        pending.remove_prefix(m_parser.consumed());
+        m_parser.reset();
+
+        if (!keep_alive) {
+            m_status = HttpStreamStatus::closing;
+        }
+    }
+
+    // The parser resumes from the start of the unfinished request, so that is where the kept bytes begin
+    if (m_status != HttpStreamStatus::open) {
+        m_buffer.clear();
+    } else if (buffered) {
+        m_buffer.erase(0, m_buffer.size() - pending.size());
+    } else {
+        m_buffer.assign(pending);
+    }
+
+    return m_status;
+}
+
+auto HttpRequestStream::feed_body(std::string_view t_data, std::vector<HttpStreamItem>& t_items)
+    -> std::string_view
+{
+    BodyPiece piece;
+
+    if (m_chunked) {
+        auto [status, consumed] = m_chunked_decoder.decode(t_data, piece.data);
+        if (status == details::ChunkedStatus::error) {
+            m_status = HttpStreamStatus::error;
+            return {};
+        }
+
+        piece.last = status == details::ChunkedStatus::complete;
+        t_data.remove_prefix(consumed);
+    } else {
+        auto size = std::min(m_body_remaining, t_data.size());
+        piece.data.assign(t_data.substr(0, size));
+        m_body_remaining -= size;
+
+        piece.last = m_body_remaining == 0;
+        t_data.remove_prefix(size);
+    }
+
+    auto last = piece.last;
+
+    // Reads holding nothing but chunk framing produce no piece
+    if (!piece.data.empty() || last) {
+        t_items.emplace_back(std::move(piece));
+    }
+
+    if (last) {
+        m_streaming = false;
+        if (!m_keep_alive_after_body) {
+            m_status = HttpStreamStatus::closing;
+        }
+    }
+
+    return t_data;
+}
+}
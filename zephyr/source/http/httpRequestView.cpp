@@ -0,0 +1,84 @@
+#include "zephyr/http/httpRequestView.hpp"
+
+#include "zephyr/http/httpHeaders.hpp"
+
+#include <algorithm>
+
+namespace zephyr::http
+{
+namespace
+{
+auto lower(char t_c) -> char
+{
+    return (t_c >= 'A' && t_c <= 'Z') ? static_cast<char>(t_c - 'A' + 'a') : t_c;
+}
+
+auto iequals(std::string_view t_a, std::string_view t_b) -> bool
+{
+    return t_a.size() == t_b.size()
+        && std::ranges::equal(t_a, t_b, [](char a, char b) { return lower(a) == lower(b); });
+}
+
+// Connection is a comma-separated list of options
+auto has_option(std::string_view t_list, std::string_view t_option) -> bool
+{
+    while (!t_list.empty()) {
+        auto comma = t_list.find(',');
+        auto item = t_list.substr(0, comma);
+        t_list = comma == std::string_view::npos ? std::string_view{} : t_list.substr(comma + 1);
+
+        while (!item.empty() && (item.front() == ' ' || item.front() == '\t')) {
+            item.remove_prefix(1);
+        }
+        while (!item.empty() && (item.back() == ' ' || item.back() == '\t')) {
+            item.remove_suffix(1);
+        }
+
+        if (iequals(item, t_option)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+}
+
+auto HttpRequestView::header(std::string_view t_name) const noexcept
+    -> std::optional<std::string_view>
+{
+    for (const auto& h : headers()) {
+        if (iequals(h.name, t_name)) {
+            return h.value;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto HttpRequestView::keep_alive() const noexcept
+    -> bool
+{
+    auto connection = header(headers::connection).value_or(std::string_view{});
+    if (version == "HTTP/1.0") {
+        return has_option(connection, "keep-alive");
+    }
+
+    return !has_option(connection, "close");
+}
+
+auto HttpRequestView::to_request() const
+    -> HttpRequest
+{
+    HttpRequest req;
+    req.method = method;
+    req.path = path;
+    req.version = version;
+    req.body = body;
+
+    for (const auto& h : headers()) {
+        req.headers.emplace(h.name, h.value);
+    }
+
+    return req;
+}
+}
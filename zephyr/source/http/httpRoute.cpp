@@ -0,0 +1,39 @@
+#include "zephyr/http/httpRoute.hpp"
+
+#include <algorithm>
+
+namespace zephyr::http
+{
+auto HttpRoute::bind_params(HttpRequest& t_request, std::span<const std::string_view> t_values) const
+    -> void
+{
+    t_request.path_params.clear();
+
+    for (size_t i = 0; i < std::min(m_param_names.size(), t_values.size()); ++i) {
+        t_request.path_params.emplace(m_param_names[i], t_values[i]);
+    }
+}
+
+auto HttpRoute::invoke(HttpRequest t_request, const context::Context& t_context) const
+    -> HttpSender
+{
+    return m_handler(t_request, t_context);
+}
+
+auto HttpRoute::collect_param_names()
+    -> void
+{
+    size_t pos = 0;
+
+    while ((pos = m_pattern.find(':', pos)) != std::string::npos) {
+        size_t end = m_pattern.find('/', pos);
+
+        if (end == std::string::npos) {
+            end = m_pattern.size();
+        }
+
+        m_param_names.push_back(m_pattern.substr(pos + 1, end - pos - 1));
+        pos = end;
+    }
+}
+}
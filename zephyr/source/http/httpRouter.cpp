@@ -0,0 +1,42 @@
+#include "zephyr/http/httpRouter.hpp"
+
+#include <string_view>
+
+namespace zephyr::http
+{
+auto HttpRouter::route(HttpRequest t_request) const
+    -> HttpSender
+{
+    std::string_view path = t_request.path;
+    path = path.substr(0, path.find('?'));
+
+    details::RouteMatch match;
+    if (!m_tree.find(t_request.method, path, match)) {
+        return HttpSender{stdexec::just(HttpResponse::not_found())};
+    }
+
+    // The captured values point into t_request.path, so they are copied out before it moves
+    const auto& r = m_routes[match.route];
+    r.bind_params(t_request, match.params());
+    return r.invoke(std::move(t_request), *m_context);
+}
+
+auto HttpRouter::streams_body(std::string_view t_method, std::string_view t_path) const
+    -> bool
+{
+    if (!m_has_streaming_routes) {
+        return false;
+    }
+
+    details::RouteMatch match;
+    return m_tree.find(t_method, t_path.substr(0, t_path.find('?')), match) && m_routes[match.route].streams_body();
+}
+
+auto HttpRouter::add(HttpRoute t_route)
+    -> void
+{
+    m_tree.insert(t_route.method(), t_route.pattern(), m_routes.size());
+    m_has_streaming_routes = m_has_streaming_routes || t_route.streams_body();
+    m_routes.push_back(std::move(t_route));
+}
+}
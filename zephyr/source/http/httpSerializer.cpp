@@ -0,0 +1,359 @@
+#include "zephyr/http/httpSerializer.hpp"
+
+#include "zephyr/http/details/httpDate.hpp"
+#include "zephyr/http/httpHeaders.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace zephyr::http
+{
+namespace
+{
+struct StatusReason
+{
+    int code;
+    std::string_view reason;
+};
+
+// Reason phrases from the IANA status code registry (RFC 9110 and its extensions)
+constexpr std::array STATUS_REASONS{
+    StatusReason{100, "Continue"},
+    StatusReason{101, "Switching Protocols"},
+    StatusReason{102, "Processing"},
+    StatusReason{103, "Early Hints"},
+    StatusReason{200, "OK"},
+    StatusReason{201, "Created"},
+    StatusReason{202, "Accepted"},
+    StatusReason{203, "Non-Authoritative Information"},
+    StatusReason{204, "No Content"},
+    StatusReason{205, "Reset Content"},
+    StatusReason{206, "Partial Content"},
+    StatusReason{207, "Multi-Status"},
+    StatusReason{208, "Already Reported"},
+    StatusReason{226, "IM Used"},
+    StatusReason{300, "Multiple Choices"},
+    StatusReason{301, "Moved Permanently"},
+    StatusReason{302, "Found"},
+    StatusReason{303, "See Other"},
+    StatusReason{304, "Not Modified"},
+    StatusReason{305, "Use Proxy"},
+    StatusReason{307, "Temporary Redirect"},
+    StatusReason{308, "Permanent Redirect"},
+    StatusReason{400, "Bad Request"},
+    StatusReason{401, "Unauthorized"},
+    StatusReason{402, "Payment Required"},
+    StatusReason{403, "Forbidden"},
+    StatusReason{404, "Not Found"},
+    StatusReason{405, "Method Not Allowed"},
+    StatusReason{406, "Not Acceptable"},
+    StatusReason{407, "Proxy Authentication Required"},
+    StatusReason{408, "Request Timeout"},
+    StatusReason{409, "Conflict"},
+    StatusReason{410, "Gone"},
+    StatusReason{411, "Length Required"},
+    StatusReason{412, "Precondition Failed"},
+    StatusReason{413, "Content Too Large"},
+    StatusReason{414, "URI Too Long"},
+    StatusReason{415, "Unsupported Media Type"},
+    StatusReason{416, "Range Not Satisfiable"},
+    StatusReason{417, "Expectation Failed"},
+    StatusReason{421, "Misdirected Request"},
+    StatusReason{422, "Unprocessable Content"},
+    StatusReason{423, "Locked"},
+    StatusReason{424, "Failed Dependency"},
+    StatusReason{425, "Too Early"},
+    StatusReason{426, "Upgrade Required"},
+    StatusReason{428, "Precondition Required"},
+    StatusReason{429, "Too Many Requests"},
+    StatusReason{431, "Request Header Fields Too Large"},
+    StatusReason{451, "Unavailable For Legal Reasons"},
+    StatusReason{500, "Internal Server Error"},
+    StatusReason{501, "Not Implemented"},
+    StatusReason{502, "Bad Gateway"},
+    StatusReason{503, "Service Unavailable"},
+    StatusReason{504, "Gateway Timeout"},
+    StatusReason{505, "HTTP Version Not Supported"},
+    StatusReason{506, "Variant Also Negotiates"},
+    StatusReason{507, "Insufficient Storage"},
+    StatusReason{508, "Loop Detected"},
+    StatusReason{510, "Not Extended"},
+    StatusReason{511, "Network Authentication Required"},
+};
+
+struct StatusLine
+{
+    std::array<char, 48> text{};
+    std::size_t size = 0;
+};
+
+// "HTTP/1.1 <code> <reason>\r\n" for every registered code, rendered during compilation into
+// read-only data shared by all threads
+consteval auto render_status_lines()
+    -> std::array<StatusLine, STATUS_REASONS.size()>
+{
+    std::array<StatusLine, STATUS_REASONS.size()> lines{};
+
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        auto& line = lines[i];
+        const auto append = [&line](std::string_view t_text) {
+            for (const char c : t_text) {
+                line.text[line.size++] = c;
+            }
+        };
+
+        const auto code = STATUS_REASONS[i].code;
+        const char digits[] = {static_cast<char>('0' + code / 100), static_cast<char>('0' + code / 10 % 10),
+                               static_cast<char>('0' + code % 10)};
+
+        append("HTTP/1.1 ");
+        append({digits, sizeof(digits)});
+        append(" ");
+        append(STATUS_REASONS[i].reason);
+        append("\r\n");
+    }
+
+    return lines;
+}
+
+constexpr int FIRST_STATUS = 100;
+constexpr int LAST_STATUS = 599;
+
+// Status code -> position in STATUS_REASONS plus one, 0 for unregistered codes
+consteval auto index_status_codes()
+    -> std::array<uint8_t, LAST_STATUS - FIRST_STATUS + 1>
+{
+    std::array<uint8_t, LAST_STATUS - FIRST_STATUS + 1> index{};
+    for (std::size_t i = 0; i < STATUS_REASONS.size(); ++i) {
+        index[STATUS_REASONS[i].code - FIRST_STATUS] = static_cast<uint8_t>(i + 1);
+    }
+    return index;
+}
+
+constexpr auto STATUS_LINES = render_status_lines();
+constexpr auto STATUS_INDEX = index_status_codes();
+
+// Every response that may carry a body states its length, even 0, so a kept-alive connection can
+// tell where the next response starts (RFC 9112, 6.3). A streamed body's length is not known up front.
+auto needs_content_length(const HttpResponse& t_response) -> bool
+{
+    const auto code = t_response.status_code;
+    if (code < 200 || code == 204 || code == 304 || t_response.body_producer) {
+        return false;
+    }
+
+    return !t_response.headers.contains(headers::content_length);
+}
+
+auto append_header(std::string& t_out, std::string_view t_name, std::string_view t_value)
+    -> void
+{
+    t_out.append(t_name).append(": ").append(t_value).append("\r\n");
+}
+
+// Header lines and the blank line that ends them, sized up front so the string grows once.
+// Content-Length and Date are added unless the handler set them.
+auto render_headers(const HttpResponse& t_response, std::string& t_out, bool t_chunked = false)
+    -> void
+{
+    constexpr std::string_view chunked = "chunked";
+
+    char length_digits[20];
+    std::string_view content_length;
+    if (!t_chunked && needs_content_length(t_response)) {
+        const auto body_size = t_response.file_body ? t_response.file_body->length : t_response.body.size();
+        auto [end, ec] = std::to_chars(std::begin(length_digits), std::end(length_digits), body_size);
+        content_length = {length_digits, static_cast<std::size_t>(end - length_digits)};
+    }
+
+    std::string_view date;
+    if (!t_response.headers.contains(headers::date)) {
+        date = details::cached_http_date();
+    }
+
+    std::size_t size = 2;
+    for (const auto& [name, value] : t_response.headers) {
+        size += name.size() + value.size() + 4;
+    }
+    if (!content_length.empty()) {
+        size += headers::content_length.size() + content_length.size() + 4;
+    }
+    if (!date.empty()) {
+        size += headers::date.size() + date.size() + 4;
+    }
+    if (t_chunked) {
+        size += headers::transfer_encoding.size() + chunked.size() + 4;
+    }
+    t_out.reserve(t_out.size() + size);
+
+    for (const auto& [name, value] : t_response.headers) {
+        append_header(t_out, name, value);
+    }
+    if (!content_length.empty()) {
+        append_header(t_out, headers::content_length, content_length);
+    }
+    if (!date.empty()) {
+        append_header(t_out, headers::date, date);
+    }
+    if (t_chunked) {
+        append_header(t_out, headers::transfer_encoding, chunked);
+    }
+
+    t_out.append("\r\n");
+}
+
+// The header lines a prerendered response is written with and the blank line after them
+auto render_added_headers(const HttpResponse& t_response, std::string& t_out)
+    -> void
+{
+    for (const auto& [name, value] : t_response.headers) {
+        append_header(t_out, name, value);
+    }
+    t_out.append("\r\n");
+}
+
+// Only for codes outside the registry or custom reason phrases
+auto render_status_line(const HttpResponse& t_response, std::string& t_out)
+    -> void
+{
+    char digits[12];
+    auto [end, ec] = std::to_chars(std::begin(digits), std::end(digits), t_response.status_code);
+
+    t_out.append("HTTP/1.1 ").append(digits, end).append(" ");
+    t_out.append(t_response.status_text).append("\r\n");
+}
+}
+
+auto HttpSerializer::serialize(const HttpResponse &t_response)
+    -> std::string
+{
+    if (t_response.prerendered) {
+        std::string result = *t_response.prerendered->head;
+        render_added_headers(t_response, result);
+        result += *t_response.prerendered->body;
+        return result;
+    }
+
+    std::string result;
+    result.reserve(64 + t_response.body.size());
+
+    if (auto line = status_line(t_response.status_code, t_response.status_text); !line.empty()) {
+        result.append(line);
+    } else {
+        render_status_line(t_response, result);
+    }
+    render_headers(t_response, result);
+    result += t_response.body;
+
+    return result;
+}
+
+auto HttpSerializer::serialize_vectored(HttpResponse t_response)
+    -> io::GatherBuffer
+{
+    if (t_response.prerendered) {
+        io::GatherBuffer output;
+        output.append_shared(t_response.prerendered->head);
+
+        std::string added;
+        render_added_headers(t_response, added);
+        output.append(std::move(added));
+
+        output.append_shared(t_response.prerendered->body);
+        return output;
+    }
+
+    if (t_response.body_producer) {
+        return serialize_head(t_response, !t_response.headers.contains(headers::content_length));
+    }
+    if (t_response.file_body) {
+        return serialize_head(t_response, false);
+    }
+
+    auto output = serialize_head(t_response, false);
+    output.append(std::move(t_response.body));
+
+    return output;
+}
+
+auto HttpSerializer::serialize_head(const HttpResponse& t_response, bool t_chunked)
+    -> io::GatherBuffer
+{
+    io::GatherBuffer output;
+    std::string head;
+
+    if (auto line = status_line(t_response.status_code, t_response.status_text); !line.empty()) {
+        output.append_static(line);
+    } else {
+        render_status_line(t_response, head);
+    }
+
+    render_headers(t_response, head, t_chunked);
+    output.append(std::move(head));
+
+    return output;
+}
+
+auto HttpSerializer::prerender(HttpResponse t_response)
+    -> PrerenderedResponse
+{
+    std::string head;
+    if (auto line = status_line(t_response.status_code, t_response.status_text); !line.empty()) {
+        head.append(line);
+    } else {
+        render_status_line(t_response, head);
+    }
+
+    // The blank line goes out after the headers each write adds
+    render_headers(t_response, head);
+    head.resize(head.size() - 2);
+
+    return {
+        t_response.status_code,
+        std::move(t_response.status_text),
+        std::make_shared<const std::string>(std::move(head)),
+        std::make_shared<const std::string>(std::move(t_response.body))
+    };
+}
+
+auto HttpSerializer::chunk(std::string t_data)
+    -> io::GatherBuffer
+{
+    io::GatherBuffer output;
+    if (t_data.empty()) {
+        return output;
+    }
+
+    char size_line[20];
+    auto [end, ec] = std::to_chars(std::begin(size_line), std::end(size_line) - 2, t_data.size(), 16);
+    *end++ = '\r';
+    *end++ = '\n';
+
+    output.append(std::string{size_line, end});
+    output.append(std::move(t_data));
+    output.append_static("\r\n");
+
+    return output;
+}
+
+auto HttpSerializer::status_line(int t_status_code, std::string_view t_status_text) noexcept
+    -> std::string_view
+{
+    if (t_status_code < FIRST_STATUS || t_status_code > LAST_STATUS) {
+        return {};
+    }
+
+    const auto index = STATUS_INDEX[t_status_code - FIRST_STATUS];
+    if (index == 0 || STATUS_REASONS[index - 1].reason != t_status_text) {
+        return {};
+    }
+
+    const auto& line = STATUS_LINES[index - 1];
+    return {line.text.data(), line.size};
+}
+}
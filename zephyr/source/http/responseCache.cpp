@@ -0,0 +1,274 @@
+#include "zephyr/http/responseCache.hpp"
+
+#include "zephyr/http/httpHeaders.hpp"
+#include "zephyr/http/httpSerializer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <utility>
+
+namespace zephyr::http
+{
+namespace
+{
+auto iequals(std::string_view t_a, std::string_view t_b) -> bool
+{
+    return std::ranges::equal(t_a, t_b, [](char a, char b) {
+        return (a >= 'A' && a <= 'Z' ? a + 32 : a) == (b >= 'A' && b <= 'Z' ? b + 32 : b);
+    });
+}
+
+// Request headers keep the case the client sent them in
+auto find_header(const HttpHeaders& t_headers, std::string_view t_name) -> const std::string*
+{
+    if (auto it = t_headers.find(t_name); it != t_headers.end()) {
+        return &it->second;
+    }
+
+    for (const auto& [name, value] : t_headers) {
+        if (iequals(name, t_name)) {
+            return &value;
+        }
+    }
+
+    return nullptr;
+}
+
+auto trim(std::string_view t_text) -> std::string_view
+{
+    while (!t_text.empty() && (t_text.front() == ' ' || t_text.front() == '\t')) {
+        t_text.remove_prefix(1);
+    }
+    while (!t_text.empty() && (t_text.back() == ' ' || t_text.back() == '\t')) {
+        t_text.remove_suffix(1);
+    }
+    return t_text;
+}
+
+// Whether a Cache-Control value has any of t_directives, with or without an argument
+template<std::size_t N>
+auto has_directive(const HttpHeaders& t_headers, const std::array<std::string_view, N>& t_directives) -> bool
+{
+    const auto* value = find_header(t_headers, headers::cache_control);
+    if (!value) {
+        return false;
+    }
+
+    std::string_view rest = *value;
+    while (!rest.empty()) {
+        const auto comma = rest.find(',');
+        auto directive = trim(rest.substr(0, comma));
+        directive = trim(directive.substr(0, directive.find('=')));
+        rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+
+        for (const auto name : t_directives) {
+            if (iequals(directive, name)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Codes a cache may store without explicit freshness information (RFC 9110, section 15.1)
+constexpr std::array cacheable_statuses{200, 203, 204, 300, 301, 308, 404, 405, 410, 414, 501};
+
+constexpr std::array<std::string_view, 2> request_bypass{"no-cache", "no-store"};
+constexpr std::array<std::string_view, 3> response_bypass{"no-cache", "no-store", "private"};
+}
+
+ResponseCache::ResponseCache(ResponseCacheOptions t_options)
+    : m_options(std::move(t_options))
+{
+    m_options.shards = std::max<std::size_t>(m_options.shards, 1);
+    m_shard_bytes = m_options.max_bytes / m_options.shards;
+    m_shards = std::make_unique<Shard[]>(m_options.shards);
+}
+
+auto ResponseCache::key(const HttpRequest& t_request) const
+    -> std::string
+{
+    if (t_request.method != "GET" || has_directive(t_request.headers, request_bypass)) {
+        return {};
+    }
+
+    // A response for one user is not served to another unless the credentials are part of the key
+    const auto keys_authorization = std::ranges::any_of(m_options.key_headers, [](const std::string& t_name) {
+        return iequals(t_name, headers::authorization);
+    });
+    if (!keys_authorization && find_header(t_request.headers, headers::authorization)) {
+        return {};
+    }
+
+    std::string key = t_request.method;
+    key.append(" ").append(t_request.path);
+    for (const auto& name : m_options.key_headers) {
+        key.push_back('\n');
+        if (const auto* value = find_header(t_request.headers, name)) {
+            key.append(*value);
+        }
+    }
+
+    return key;
+}
+
+auto ResponseCache::lookup(const std::string& t_key, HttpResponse& t_hit, Waiter t_waiter)
+    -> CacheLookup
+{
+    const auto now = Clock::now();
+    auto& shard = shard_for(t_key);
+
+    std::shared_ptr<const PrerenderedResponse> response;
+    Clock::time_point stored;
+    {
+        std::lock_guard lock(shard.mutex);
+        if (auto it = shard.entries.find(t_key); it != shard.entries.end()) {
+            if (now - it->second.stored < m_options.ttl) {
+                shard.order.splice(shard.order.begin(), shard.order, it->second.position);
+                response = it->second.response;
+                stored = it->second.stored;
+            } else {
+                erase(shard, it);
+            }
+        }
+
+        if (!response) {
+            if (auto it = shard.in_flight.find(t_key); it != shard.in_flight.end()) {
+                it->second.push_back(std::move(t_waiter));
+                return CacheLookup::joined;
+            }
+
+            shard.in_flight.emplace(t_key, std::vector<Waiter>{});
+            return CacheLookup::miss;
+        }
+    }
+
+    t_hit = respond(std::move(response));
+    const auto age = std::chrono::duration_cast<std::chrono::seconds>(now - stored).count();
+    t_hit.headers.emplace(headers::age, std::to_string(age));
+    return CacheLookup::hit;
+}
+
+auto ResponseCache::complete(const std::string& t_key, HttpResponse t_response)
+    -> HttpResponse
+{
+    if (!cacheable(t_response)) {
+        for (auto& waiter : finish(t_key, nullptr)) {
+            waiter(std::nullopt);
+        }
+        return t_response;
+    }
+
+    // Hop-by-hop: every write states its own
+    t_response.headers.erase(std::string{headers::connection});
+    auto response = std::make_shared<const PrerenderedResponse>(HttpSerializer::prerender(std::move(t_response)));
+
+    for (auto& waiter : finish(t_key, response)) {
+        waiter(respond(response));
+    }
+    return respond(std::move(response));
+}
+
+auto ResponseCache::abandon(const std::string& t_key)
+    -> void
+{
+    for (auto& waiter : finish(t_key, nullptr)) {
+        waiter(std::nullopt);
+    }
+}
+
+auto ResponseCache::cacheable(const HttpResponse& t_response)
+    -> bool
+{
+    if (t_response.body_producer || t_response.file_body || t_response.prerendered) {
+        return false;
+    }
+
+    if (std::ranges::find(cacheable_statuses, t_response.status_code) == cacheable_statuses.end()) {
+        return false;
+    }
+
+    return !find_header(t_response.headers, headers::set_cookie) && !has_directive(t_response.headers, response_bypass);
+}
+
+auto ResponseCache::size() const
+    -> std::size_t
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < m_options.shards; ++i) {
+        std::lock_guard lock(m_shards[i].mutex);
+        total += m_shards[i].entries.size();
+    }
+    return total;
+}
+
+auto ResponseCache::bytes() const
+    -> std::size_t
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < m_options.shards; ++i) {
+        std::lock_guard lock(m_shards[i].mutex);
+        total += m_shards[i].bytes;
+    }
+    return total;
+}
+
+auto ResponseCache::shard_for(const std::string& t_key) const
+    -> Shard&
+{
+    return m_shards[std::hash<std::string>{}(t_key) % m_options.shards];
+}
+
+auto ResponseCache::finish(const std::string& t_key, std::shared_ptr<const PrerenderedResponse> t_response)
+    -> std::vector<Waiter>
+{
+    auto& shard = shard_for(t_key);
+    const auto size = t_response ? t_key.size() + t_response->head->size() + t_response->body->size() : 0;
+
+    std::lock_guard lock(shard.mutex);
+
+    std::vector<Waiter> waiters;
+    if (auto it = shard.in_flight.find(t_key); it != shard.in_flight.end()) {
+        waiters = std::move(it->second);
+        shard.in_flight.erase(it);
+    }
+
+    if (!t_response || size > m_options.max_entry_bytes || size > m_shard_bytes) {
+        return waiters;
+    }
+
+    if (auto it = shard.entries.find(t_key); it != shard.entries.end()) {
+        erase(shard, it);
+    }
+
+    while (shard.bytes + size > m_shard_bytes) {
+        erase(shard, shard.entries.find(shard.order.back()));
+    }
+
+    shard.order.push_front(t_key);
+    shard.entries.emplace(t_key, Entry{std::move(t_response), Clock::now(), size, shard.order.begin()});
+    shard.bytes += size;
+
+    return waiters;
+}
+
+auto ResponseCache::erase(Shard& t_shard, std::unordered_map<std::string, Entry>::iterator t_entry)
+    -> void
+{
+    t_shard.bytes -= t_entry->second.bytes;
+    t_shard.order.erase(t_entry->second.position);
+    t_shard.entries.erase(t_entry);
+}
+
+auto ResponseCache::respond(std::shared_ptr<const PrerenderedResponse> t_response)
+    -> HttpResponse
+{
+    HttpResponse response{};
+    response.status_code = t_response->status_code;
+    response.status_text = t_response->status_text;
+    response.prerendered = std::move(t_response);
+    return response;
+}
+}
@@ -0,0 +1,352 @@
+#include "zephyr/http/staticFiles.hpp"
+
+#include "zephyr/http/httpHeaders.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace zephyr::http
+{
+namespace
+{
+auto iequals(std::string_view t_a, std::string_view t_b) -> bool
+{
+    return std::ranges::equal(t_a, t_b, [](char a, char b) {
+        return (a >= 'A' && a <= 'Z' ? a + 32 : a) == (b >= 'A' && b <= 'Z' ? b + 32 : b);
+    });
+}
+
+// Request headers keep the case the client sent them in
+auto find_header(const HttpHeaders& t_headers, std::string_view t_name) -> std::optional<std::string_view>
+{
+    if (auto it = t_headers.find(t_name); it != t_headers.end()) {
+        return it->second;
+    }
+
+    for (const auto& [name, value] : t_headers) {
+        if (iequals(name, t_name)) {
+            return value;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto trim(std::string_view t_text) -> std::string_view
+{
+    while (!t_text.empty() && (t_text.front() == ' ' || t_text.front() == '\t')) {
+        t_text.remove_prefix(1);
+    }
+    while (!t_text.empty() && (t_text.back() == ' ' || t_text.back() == '\t')) {
+        t_text.remove_suffix(1);
+    }
+    return t_text;
+}
+
+auto hex_value(char t_digit) -> int
+{
+    if (t_digit >= '0' && t_digit <= '9') {
+        return t_digit - '0';
+    }
+    if (t_digit >= 'a' && t_digit <= 'f') {
+        return t_digit - 'a' + 10;
+    }
+    if (t_digit >= 'A' && t_digit <= 'F') {
+        return t_digit - 'A' + 10;
+    }
+    return -1;
+}
+
+// Empty on a malformed escape or an encoded NUL
+auto percent_decode(std::string_view t_path) -> std::optional<std::string>
+{
+    std::string out;
+    out.reserve(t_path.size());
+
+    for (std::size_t i = 0; i < t_path.size(); ++i) {
+        if (t_path[i] != '%') {
+            out.push_back(t_path[i]);
+            continue;
+        }
+
+        if (i + 2 >= t_path.size()) {
+            return std::nullopt;
+        }
+
+        const auto high = hex_value(t_path[i + 1]);
+        const auto low = hex_value(t_path[i + 2]);
+        if (high < 0 || low < 0 || (high == 0 && low == 0)) {
+            return std::nullopt;
+        }
+
+        out.push_back(static_cast<char>(high * 16 + low));
+        i += 2;
+    }
+
+    return out;
+}
+
+// If-None-Match uses the weak comparison, so W/ prefixes are ignored on both sides
+auto matches_etag(std::string_view t_condition, std::string_view t_etag) -> bool
+{
+    auto strip_weak = [](std::string_view t_tag) {
+        return t_tag.starts_with("W/") ? t_tag.substr(2) : t_tag;
+    };
+
+    t_etag = strip_weak(t_etag);
+    while (!t_condition.empty()) {
+        const auto comma = t_condition.find(',');
+        const auto tag = trim(t_condition.substr(0, comma));
+        if (tag == "*" || strip_weak(tag) == t_etag) {
+            return true;
+        }
+        t_condition = comma == std::string_view::npos ? std::string_view{} : t_condition.substr(comma + 1);
+    }
+
+    return false;
+}
+
+struct ByteRange
+{
+    uint64_t first = 0;
+    uint64_t length = 0;
+};
+
+enum class RangeResult
+{
+    // No usable Range header: the whole file is sent
+    ignored,
+    satisfiable,
+    unsatisfiable
+};
+
+auto parse_number(std::string_view t_text, uint64_t& t_value) -> bool
+{
+    if (t_text.empty()) {
+        return false;
+    }
+    auto [end, ec] = std::from_chars(t_text.data(), t_text.data() + t_text.size(), t_value);
+    return ec == std::errc{} && end == t_text.data() + t_text.size();
+}
+
+auto parse_range(std::string_view t_header, uint64_t t_size, ByteRange& t_range) -> RangeResult
+{
+    constexpr std::string_view unit = "bytes=";
+    if (t_header.size() < unit.size() || !iequals(t_header.substr(0, unit.size()), unit)) {
+        return RangeResult::ignored;
+    }
+
+    const auto spec = trim(t_header.substr(unit.size()));
+    const auto dash = spec.find('-');
+    if (spec.find(',') != std::string_view::npos || dash == std::string_view::npos) {
+        return RangeResult::ignored;
+    }
+
+    const auto first_text = trim(spec.substr(0, dash));
+    const auto last_text = trim(spec.substr(dash + 1));
+
+    // "-n" asks for the last n bytes
+    if (first_text.empty()) {
+        uint64_t suffix = 0;
+        if (!parse_number(last_text, suffix)) {
+            return RangeResult::ignored;
+        }
+        if (suffix == 0 || t_size == 0) {
+            return RangeResult::unsatisfiable;
+        }
+        suffix = std::min(suffix, t_size);
+        t_range = {t_size - suffix, suffix};
+        return RangeResult::satisfiable;
+    }
+
+    uint64_t first = 0;
+    uint64_t last = t_size == 0 ? 0 : t_size - 1;
+    if (!parse_number(first_text, first)) {
+        return RangeResult::ignored;
+    }
+    if (!last_text.empty()) {
+        uint64_t requested = 0;
+        if (!parse_number(last_text, requested) || requested < first) {
+            return RangeResult::ignored;
+        }
+        last = std::min(last, requested);
+    }
+
+    if (first >= t_size) {
+        return RangeResult::unsatisfiable;
+    }
+
+    t_range = {first, last - first + 1};
+    return RangeResult::satisfiable;
+}
+
+auto to_string(uint64_t t_value) -> std::string
+{
+    char digits[24];
+    auto [end, ec] = std::to_chars(std::begin(digits), std::end(digits), t_value);
+    return {digits, end};
+}
+
+struct ContentType
+{
+    std::string_view extension;
+    std::string_view type;
+};
+
+constexpr std::array content_types{
+    ContentType{"css", "text/css; charset=utf-8"},
+    ContentType{"gif", "image/gif"},
+    ContentType{"htm", "text/html; charset=utf-8"},
+    ContentType{"html", "text/html; charset=utf-8"},
+    ContentType{"ico", "image/x-icon"},
+    ContentType{"jpeg", "image/jpeg"},
+    ContentType{"jpg", "image/jpeg"},
+    ContentType{"js", "text/javascript; charset=utf-8"},
+    ContentType{"json", "application/json"},
+    ContentType{"mjs", "text/javascript; charset=utf-8"},
+    ContentType{"pdf", "application/pdf"},
+    ContentType{"png", "image/png"},
+    ContentType{"svg", "image/svg+xml"},
+    ContentType{"txt", "text/plain; charset=utf-8"},
+    ContentType{"wasm", "application/wasm"},
+    ContentType{"webp", "image/webp"},
+    ContentType{"woff", "font/woff"},
+    ContentType{"woff2", "font/woff2"},
+    ContentType{"xml", "application/xml"},
+};
+}
+
+StaticFiles::StaticFiles(std::string t_url_prefix, std::string t_root, StaticFileOptions t_options)
+    : m_url_prefix(std::move(t_url_prefix))
+    , m_root(std::move(t_root))
+    , m_options(std::move(t_options))
+    , m_files(std::make_shared<details::OpenFileCache>(m_options.max_open_files, m_options.revalidate_after))
+{
+    while (m_url_prefix.ends_with('/')) {
+        m_url_prefix.pop_back();
+    }
+    while (m_root.size() > 1 && m_root.ends_with('/')) {
+        m_root.pop_back();
+    }
+}
+
+auto StaticFiles::operator()(const HttpRequest& t_request, const context::Context&) const
+    -> HttpResponse
+{
+    const auto path = resolve(t_request.path);
+    const auto file = path.empty() ? nullptr : m_files->open(path);
+    if (!file) {
+        return HttpResponse::not_found();
+    }
+
+    HttpResponse response{};
+    response.headers.emplace(headers::etag, file->etag);
+    response.headers.emplace(headers::last_modified, file->last_modified);
+    if (!m_options.cache_control.empty()) {
+        response.headers.emplace(headers::cache_control, m_options.cache_control);
+    }
+
+    if (auto condition = find_header(t_request.headers, headers::if_none_match);
+        condition && matches_etag(*condition, file->etag)) {
+        response.status_code = 304;
+        response.status_text = "Not Modified";
+        return response;
+    }
+
+    response.headers.emplace(headers::accept_ranges, "bytes");
+    response.headers.emplace(headers::content_type, content_type(path));
+
+    ByteRange range{0, file->size};
+    if (auto header = find_header(t_request.headers, headers::range)) {
+        switch (parse_range(*header, file->size, range)) {
+        case RangeResult::ignored:
+            range = {0, file->size};
+            break;
+        case RangeResult::satisfiable:
+            response.status_code = 206;
+            response.status_text = "Partial Content";
+            response.headers.emplace(headers::content_range,
+                "bytes " + to_string(range.first) + "-" + to_string(range.first + range.length - 1) + "/"
+                    + to_string(file->size));
+            break;
+        case RangeResult::unsatisfiable:
+            response.status_code = 416;
+            response.status_text = "Range Not Satisfiable";
+            response.headers.erase(std::string{headers::content_type});
+            response.headers.emplace(headers::content_range, "bytes */" + to_string(file->size));
+            return response;
+        }
+    }
+
+    // A HEAD response states the length of the body it leaves out
+    if (t_request.method == "HEAD") {
+        response.headers.emplace(headers::content_length, to_string(range.length));
+        return response;
+    }
+
+    response.file_body = io::FileRegion{file->fd, range.first, static_cast<std::size_t>(range.length), file};
+    return response;
+}
+
+auto StaticFiles::content_type(std::string_view t_path)
+    -> std::string_view
+{
+    const auto name = t_path.substr(t_path.rfind('/') + 1);
+    const auto dot = name.rfind('.');
+    if (dot != std::string_view::npos) {
+        const auto extension = name.substr(dot + 1);
+        for (const auto& [known, type] : content_types) {
+            if (iequals(known, extension)) {
+                return type;
+            }
+        }
+    }
+
+    return "application/octet-stream";
+}
+
+auto StaticFiles::resolve(std::string_view t_path) const
+    -> std::string
+{
+    t_path = t_path.substr(0, t_path.find('?'));
+    if (!t_path.starts_with(m_url_prefix)) {
+        return {};
+    }
+    t_path.remove_prefix(m_url_prefix.size());
+
+    auto decoded = percent_decode(t_path);
+    if (!decoded) {
+        return {};
+    }
+
+    std::string path = m_root;
+    std::string_view rest = *decoded;
+    while (!rest.empty()) {
+        const auto slash = rest.find('/');
+        const auto segment = rest.substr(0, slash);
+        rest = slash == std::string_view::npos ? std::string_view{} : rest.substr(slash + 1);
+
+        if (segment.empty() || segment == ".") {
+            continue;
+        }
+        if (segment == "..") {
+            return {};
+        }
+        path.append("/").append(segment);
+    }
+
+    // The root itself and anything ending in '/' name a directory
+    if (path == m_root || decoded->empty() || decoded->ends_with('/')) {
+        if (m_options.index_file.empty()) {
+            return {};
+        }
+        path.append("/").append(m_options.index_file);
+    }
+
+    return path;
+}
+}
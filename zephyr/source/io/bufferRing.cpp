@@ -0,0 +1,88 @@
+#include "zephyr/io/bufferRing.hpp"
+
+#include "zephyr/io/ioUringContext.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <liburing.h>
+
+namespace zephyr::io
+{
+BufferRing::BufferRing(IoUringContext& t_context, uint32_t t_count, uint32_t t_buffer_size)
+    : m_context(t_context),
+      m_group(t_context.allocate_buffer_group()),
+      m_count(t_count),
+      m_buffer_size(t_buffer_size),
+      m_mask(io_uring_buf_ring_mask(t_count))
+{
+    int result = 0;
+    m_ring = io_uring_setup_buf_ring(&m_context.m_ring, m_count, m_group, 0, &result);
+    if (m_ring == nullptr) {
+        throw std::system_error(-result, std::system_category(), "io_uring_setup_buf_ring");
+    }
+
+    m_storage = std::make_unique<std::byte[]>(static_cast<std::size_t>(m_count) * m_buffer_size);
+
+    for (uint32_t id = 0; id < m_count; ++id) {
+        io_uring_buf_ring_add(m_ring, m_storage.get() + (static_cast<std::size_t>(id) * m_buffer_size), m_buffer_size,
+                              static_cast<uint16_t>(id), m_mask, static_cast<int>(id));
+    }
+    io_uring_buf_ring_advance(m_ring, static_cast<int>(m_count));
+}
+
+BufferRing::~BufferRing()
+{
+    io_uring_free_buf_ring(&m_context.m_ring, m_ring, m_count, m_group);
+}
+
+auto BufferRing::take(uint32_t t_cqe_flags, std::size_t t_length) noexcept -> ProvidedBuffer
+{
+    const auto id = static_cast<uint16_t>(t_cqe_flags >> IORING_CQE_BUFFER_SHIFT);
+    m_outstanding.fetch_add(1, std::memory_order_relaxed);
+
+    auto* begin = m_storage.get() + (static_cast<std::size_t>(id) * m_buffer_size);
+
+    return ProvidedBuffer{this, id, std::span<std::byte>{begin, t_length}};
+}
+
+auto BufferRing::recycle(uint16_t t_id) noexcept -> void
+{
+    std::vector<std::function<void()>> waiters;
+
+    {
+        std::lock_guard lock(m_mutex);
+        io_uring_buf_ring_add(m_ring, m_storage.get() + (static_cast<std::size_t>(t_id) * m_buffer_size),
+                              m_buffer_size, t_id, m_mask, 0);
+        io_uring_buf_ring_advance(m_ring, 1);
+        m_outstanding.fetch_sub(1, std::memory_order_relaxed);
+        waiters.swap(m_waiters);
+    }
+
+    for (auto& waiter : waiters) {
+        waiter();
+    }
+}
+
+auto BufferRing::when_available(std::function<void()> t_callback) -> void
+{
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_outstanding.load(std::memory_order_relaxed) >= m_count) {
+            m_waiters.push_back(std::move(t_callback));
+            return;
+        }
+    }
+
+    // A buffer came back between the ENOBUFS completion and this call
+    t_callback();
+}
+}  // namespace zephyr::io
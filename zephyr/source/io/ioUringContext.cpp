@@ -0,0 +1,265 @@
+#include "zephyr/io/ioUringContext.hpp"
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include <liburing.h>
+#include <unistd.h>
+
+namespace zephyr::io
+{
+IoUringContext::IoUringContext(uint32_t t_entries)
+{
+    if (io_uring_queue_init(t_entries, &m_ring, 0) != 0) {
+        throw std::runtime_error("io_uring_queue_init failed");
+    }
+}
+
+IoUringContext::~IoUringContext()
+{
+    io_uring_queue_exit(&m_ring);
+}
+
+auto IoUringContext::enter_reactor() -> void
+{
+    m_reactor_thread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+}
+
+auto IoUringContext::leave_reactor() -> void
+{
+    std::lock_guard lock(m_submit_mutex);
+    m_reactor_thread.store(std::thread::id{}, std::memory_order_relaxed);
+    io_uring_submit(&m_ring);
+}
+
+auto IoUringContext::run_once() -> std::size_t
+{
+    {
+        std::lock_guard lock(m_submit_mutex);
+        io_uring_submit(&m_ring);
+    }
+
+    io_uring_cqe* cqe{nullptr};
+    if (const auto result = io_uring_wait_cqe(&m_ring, &cqe); result < 0) {
+        if (result == -EINTR || result == -EAGAIN) {
+            return 0;
+        }
+        throw std::system_error(-result, std::system_category(), "io_uring_wait_cqe");
+    }
+
+    std::array<io_uring_cqe*, COMPLETION_BATCH_SIZE> cqes{};
+    const auto count = io_uring_peek_batch_cqe(&m_ring, cqes.data(), cqes.size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto* operation = static_cast<details::IoOperationBase*>(io_uring_cqe_get_data(cqes[i]));
+        const auto result = cqes[i]->res;
+        const auto flags = cqes[i]->flags;
+
+        if (operation != nullptr) {
+            operation->complete(operation, result, flags);
+        }
+    }
+
+    io_uring_cq_advance(&m_ring, count);
+
+    expire_timers();
+
+    return count;
+}
+
+auto IoUringContext::stop() -> void
+{
+    m_stop_requested.store(true, std::memory_order_release);
+
+    // Cancels everything in flight; the CQE of the cancel request itself wakes up run_once()
+    submit([](io_uring_sqe* t_sqe) {
+        io_uring_prep_cancel(t_sqe, nullptr, IORING_ASYNC_CANCEL_ANY);
+        io_uring_sqe_set_data(t_sqe, nullptr);
+    });
+}
+
+auto IoUringContext::register_files(uint32_t t_slots) -> void
+{
+    if (const auto result = io_uring_register_files_sparse(&m_ring, t_slots); result < 0) {
+        throw std::system_error(-result, std::system_category(), "io_uring_register_files_sparse");
+    }
+
+    m_registered_files = t_slots;
+}
+
+auto IoUringContext::close(FileHandle t_file) -> void
+{
+    const auto result = submit([t_file](io_uring_sqe* t_sqe) {
+        if (t_file.fixed) {
+            io_uring_prep_close_direct(t_sqe, static_cast<unsigned>(t_file.fd));
+        } else {
+            io_uring_prep_close(t_sqe, t_file.fd);
+        }
+        io_uring_sqe_set_data(t_sqe, nullptr);
+    });
+
+    if (result != 0 && !t_file.fixed) {
+        ::close(t_file.fd);
+    }
+}
+
+auto IoUringContext::cancel(FileHandle t_file) -> void
+{
+    submit([t_file](io_uring_sqe* t_sqe) {
+        io_uring_prep_cancel_fd(t_sqe, t_file.fd,
+                                IORING_ASYNC_CANCEL_ALL | (t_file.fixed ? IORING_ASYNC_CANCEL_FD_FIXED : 0));
+        io_uring_sqe_set_data(t_sqe, nullptr);
+    });
+}
+
+auto IoUringContext::add_timer(TimerNode& t_timer, Clock::time_point t_deadline) -> uint64_t
+{
+    std::lock_guard lock(m_timer_mutex);
+    return add_timer_locked(t_timer, t_deadline);
+}
+
+auto IoUringContext::add_timer_operation(details::TimerOperationBase* t_timer, Clock::time_point t_deadline)
+    -> uint64_t
+{
+    std::lock_guard lock(m_timer_mutex);
+    if (t_timer->cancelled) {
+        return 0;
+    }
+
+    t_timer->scheduled = true;
+    return add_timer_locked(*t_timer, t_deadline);
+}
+
+auto IoUringContext::cancel_timer_operation(details::TimerOperationBase* t_timer) -> bool
+{
+    bool removed = false;
+    {
+        std::lock_guard lock(m_timer_mutex);
+
+        // Stop requested between the operation registering its stop callback and scheduling its
+        // timer; there is nothing in the wheel to remove yet
+        if (!t_timer->scheduled) {
+            t_timer->cancelled = true;
+            return false;
+        }
+
+        removed = m_timers.cancel(*t_timer);
+    }
+
+    if (removed) {
+        operation_finished();
+    }
+
+    return removed;
+}
+
+auto IoUringContext::add_timer_locked(TimerNode& t_timer, Clock::time_point t_deadline) -> uint64_t
+{
+    if (is_stopped()) {
+        return 0;
+    }
+
+    const auto was_scheduled = t_timer.is_scheduled();
+    const auto generation = m_timers.schedule(t_timer, t_deadline);
+    if (!was_scheduled) {
+        m_in_flight.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (const auto wakeup = m_timers.next_wakeup(); wakeup && *wakeup < m_timer_wakeup) {
+        arm_timer_wakeup(*wakeup);
+    }
+
+    return generation;
+}
+
+auto IoUringContext::cancel_timer(TimerNode& t_timer) -> bool
+{
+    bool removed = false;
+    {
+        std::lock_guard lock(m_timer_mutex);
+        removed = m_timers.cancel(t_timer);
+    }
+
+    // The wakeup already armed for it stays; the reactor finds nothing due and goes back to sleep
+    if (removed) {
+        operation_finished();
+    }
+
+    return removed;
+}
+
+auto IoUringContext::expire_timers() -> void
+{
+    const auto stopping = is_stopped();
+    {
+        std::lock_guard lock(m_timer_mutex);
+        if (m_timers.empty() && m_timer_wakeup == Clock::time_point::max()) {
+            return;
+        }
+
+        const auto now = Clock::now();
+        if (now >= m_timer_wakeup) {
+            m_timer_wakeup = Clock::time_point::max();
+        }
+
+        if (stopping) {
+            m_timers.clear(m_expired);
+        } else {
+            m_timers.advance(now, m_expired);
+        }
+
+        if (const auto wakeup = m_timers.next_wakeup(); wakeup && *wakeup < m_timer_wakeup) {
+            arm_timer_wakeup(*wakeup);
+        }
+    }
+
+    // Outside the lock: completions may schedule timers of their own
+    for (const auto& [timer, generation] : m_expired) {
+        timer->fire(timer, generation, !stopping);
+        operation_finished();
+    }
+    m_expired.clear();
+}
+
+auto IoUringContext::arm_timer_wakeup(Clock::time_point t_deadline) -> void
+{
+    // steady_clock is CLOCK_MONOTONIC, the clock absolute io_uring timeouts are measured against
+    const auto since_epoch = t_deadline.time_since_epoch();
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch - seconds);
+
+    // The kernel reads the timespec when the SQE is submitted, which may be deferred to run_once()
+    const auto result = submit([this, seconds, nanoseconds](io_uring_sqe* t_sqe) {
+        m_timer_wakeup_spec.tv_sec = seconds.count();
+        m_timer_wakeup_spec.tv_nsec = nanoseconds.count();
+        io_uring_prep_timeout(t_sqe, &m_timer_wakeup_spec, 0, IORING_TIMEOUT_ABS);
+        io_uring_sqe_set_data(t_sqe, nullptr);
+    });
+
+    m_timer_wakeup = result == 0 ? t_deadline : Clock::time_point::max();
+}
+
+auto IoUringContext::cancel_operation(details::IoOperationBase* t_operation) -> void
+{
+    std::lock_guard lock(m_submit_mutex);
+
+    // Stop requested between the operation registering its stop callback and submitting its SQE;
+    // an ASYNC_CANCEL now would find nothing and the operation would run uncancelled
+    if (!t_operation->submitted) {
+        t_operation->cancelled = true;
+        return;
+    }
+
+    submit_locked([t_operation](io_uring_sqe* t_sqe) {
+        io_uring_prep_cancel(t_sqe, t_operation, 0);
+        io_uring_sqe_set_data(t_sqe, nullptr);
+    });
+}
+}  // namespace zephyr::io
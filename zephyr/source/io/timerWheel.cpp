@@ -0,0 +1,209 @@
+#include "zephyr/io/timerWheel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace zephyr::io
+{
+TimerWheel::TimerWheel(Clock::duration t_tick, Clock::time_point t_start) : m_tick(t_tick), m_start(t_start)
+{
+    for (auto& sentinel : m_slots) {
+        sentinel.prev = &sentinel;
+        sentinel.next = &sentinel;
+    }
+}
+
+auto TimerWheel::schedule(TimerNode& t_node, Clock::time_point t_deadline) -> uint64_t
+{
+    if (t_node.is_scheduled()) {
+        unlink(t_node);
+    }
+
+    t_node.expiry = std::max(to_tick(t_deadline, true), m_current + 1);
+    link(t_node);
+
+    return ++t_node.generation;
+}
+
+auto TimerWheel::cancel(TimerNode& t_node) noexcept -> bool
+{
+    if (!t_node.is_scheduled()) {
+        return false;
+    }
+
+    unlink(t_node);
+    return true;
+}
+
+auto TimerWheel::advance(Clock::time_point t_now, std::vector<ExpiredTimer>& t_expired) -> void
+{
+    const auto target = to_tick(t_now, false);
+
+    while (m_current < target) {
+        if (m_size == 0) {
+            m_current = target;
+            return;
+        }
+
+        // Nothing on the finest wheel: every tick before it wraps again would be empty
+        if (std::all_of(m_occupied.begin(), m_occupied.begin() + FINE_SLOTS / 64, [](uint64_t t_bits) { return t_bits == 0; })) {
+            const auto last_before_wrap = m_current | (FINE_SLOTS - 1);
+            if (last_before_wrap >= target) {
+                m_current = target;
+                return;
+            }
+            m_current = last_before_wrap;
+        }
+
+        ++m_current;
+
+        // Each wheel hands a slot down when the one below it wraps
+        for (uint32_t level = 1; level < LEVELS; ++level) {
+            if ((m_current & ((uint64_t{1} << shift(level)) - 1)) != 0) {
+                break;
+            }
+            cascade(level);
+        }
+
+        take_slot(static_cast<uint32_t>(m_current & (FINE_SLOTS - 1)), t_expired);
+    }
+}
+
+auto TimerWheel::clear(std::vector<ExpiredTimer>& t_expired) -> void
+{
+    for (uint32_t slot = 0; slot < SLOTS && m_size != 0; ++slot) {
+        take_slot(slot, t_expired);
+    }
+}
+
+auto TimerWheel::next_wakeup() const noexcept -> std::optional<Clock::time_point>
+{
+    if (m_size == 0) {
+        return std::nullopt;
+    }
+
+    auto earliest = std::numeric_limits<uint64_t>::max();
+
+    if (const auto distance = next_occupied(0, static_cast<uint32_t>((m_current + 1) & (FINE_SLOTS - 1)));
+        distance != npos) {
+        earliest = m_current + 1 + distance;
+    }
+
+    for (uint32_t level = 1; level < LEVELS; ++level) {
+        const auto turn = m_current >> shift(level);
+        const auto distance = next_occupied(level, static_cast<uint32_t>((turn + 1) & (COARSE_SLOTS - 1)));
+        if (distance != npos) {
+            earliest = std::min(earliest, (turn + 1 + distance) << shift(level));
+        }
+    }
+
+    return m_start + m_tick * static_cast<Clock::rep>(earliest);
+}
+
+auto TimerWheel::to_tick(Clock::time_point t_time, bool t_round_up) const noexcept -> uint64_t
+{
+    const auto elapsed = t_time - m_start;
+    if (elapsed <= Clock::duration::zero()) {
+        return 0;
+    }
+
+    const auto ticks = static_cast<uint64_t>(elapsed / m_tick);
+    return t_round_up && elapsed % m_tick != Clock::duration::zero() ? ticks + 1 : ticks;
+}
+
+auto TimerWheel::link(TimerNode& t_node) noexcept -> void
+{
+    const auto delta = t_node.expiry > m_current ? t_node.expiry - m_current : 0;
+
+    uint32_t slot = 0;
+    if (delta == 0) {
+        // Handed down on the tick it is due; the current slot is taken right after
+        slot = static_cast<uint32_t>(m_current & (FINE_SLOTS - 1));
+    } else if (delta < FINE_SLOTS) {
+        slot = static_cast<uint32_t>(t_node.expiry & (FINE_SLOTS - 1));
+    } else {
+        uint32_t level = 1;
+        while (level + 1 < LEVELS && delta >= (uint64_t{1} << shift(level + 1))) {
+            ++level;
+        }
+
+        const auto target = delta < RANGE ? t_node.expiry : m_current + RANGE - 1;
+        slot = first_slot(level) + static_cast<uint32_t>((target >> shift(level)) & (COARSE_SLOTS - 1));
+    }
+
+    auto& sentinel = m_slots[slot];
+    t_node.slot = slot;
+    t_node.prev = sentinel.prev;
+    t_node.next = &sentinel;
+    sentinel.prev->next = &t_node;
+    sentinel.prev = &t_node;
+
+    m_occupied[slot / 64] |= uint64_t{1} << (slot % 64);
+    ++m_size;
+}
+
+auto TimerWheel::unlink(TimerNode& t_node) noexcept -> void
+{
+    t_node.prev->next = t_node.next;
+    t_node.next->prev = t_node.prev;
+
+    if (auto& sentinel = m_slots[t_node.slot]; sentinel.next == &sentinel) {
+        m_occupied[t_node.slot / 64] &= ~(uint64_t{1} << (t_node.slot % 64));
+    }
+
+    t_node.prev = nullptr;
+    t_node.next = nullptr;
+    --m_size;
+}
+
+auto TimerWheel::cascade(uint32_t t_level) noexcept -> void
+{
+    const auto slot = first_slot(t_level) + static_cast<uint32_t>((m_current >> shift(t_level)) & (COARSE_SLOTS - 1));
+    auto& sentinel = m_slots[slot];
+
+    // Detach the whole list first; its nodes still end with the sentinel
+    auto* node = sentinel.next;
+    sentinel.prev = &sentinel;
+    sentinel.next = &sentinel;
+    m_occupied[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+
+    while (node != &sentinel) {
+        auto* next = node->next;
+        --m_size;
+        link(*node);
+        node = next;
+    }
+}
+
+auto TimerWheel::take_slot(uint32_t t_slot, std::vector<ExpiredTimer>& t_expired) -> void
+{
+    auto& sentinel = m_slots[t_slot];
+    while (sentinel.next != &sentinel) {
+        auto* node = sentinel.next;
+        unlink(*node);
+        t_expired.push_back({node, node->generation});
+    }
+}
+
+auto TimerWheel::next_occupied(uint32_t t_level, uint32_t t_from) const noexcept -> uint32_t
+{
+    const auto count = slot_count(t_level);
+
+    // Levels start on word boundaries, so a word never mixes two of them
+    for (uint32_t distance = 0; distance < count;) {
+        const auto bit = first_slot(t_level) + (t_from + distance) % count;
+        if (const auto bits = m_occupied[bit / 64] >> (bit % 64); bits != 0) {
+            const auto found = distance + static_cast<uint32_t>(std::countr_zero(bits));
+            return found < count ? found : npos;
+        }
+        distance += 64 - bit % 64;
+    }
+
+    return npos;
+}
+}  // namespace zephyr::io
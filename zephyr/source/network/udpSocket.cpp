@@ -3,21 +3,40 @@
 #include "zephyr/core/logger.hpp"
 #include "zephyr/network/endpoint.hpp"
 
+#include <array>
 #include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <format>
+#include <span>
 #include <stdexcept>
+#include <system_error>
 #include <unistd.h>
 #include <utility>
 
+#include <linux/filter.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 
+#ifndef UDP_SEGMENT
+#    define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#    define UDP_GRO 104
+#endif
+
 namespace zephyr::network
 {
-UdpSocket::UdpSocket(UdpEndpoint t_endpoint) noexcept : m_endpoint(t_endpoint), m_socket(-1) {}
+UdpSocket::UdpSocket(UdpEndpoint t_endpoint, UdpSocketOptions t_options) noexcept
+    : m_endpoint(t_endpoint),
+      m_options(t_options),
+      m_socket(-1)
+{}
 
 UdpSocket::UdpSocket(UdpSocket&& t_other) noexcept
     : m_endpoint(t_other.m_endpoint),
+      m_options(t_other.m_options),
       m_socket(std::exchange(t_other.m_socket, -1))
 {}
 
@@ -26,6 +45,7 @@ auto UdpSocket::operator=(UdpSocket&& t_other) noexcept -> UdpSocket&
     if (this != &t_other) {
         close();
         m_endpoint = t_other.m_endpoint;
+        m_options = t_other.m_options;
         m_socket = std::exchange(t_other.m_socket, -1);
     }
     return *this;
@@ -38,11 +58,13 @@ UdpSocket::~UdpSocket() noexcept
 
 auto UdpSocket::bind(core::Logger::LoggerPtr& t_logger) -> void
 {
-    m_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    m_socket = socket(m_endpoint.isV6() ? AF_INET6 : AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (m_socket < 0) {
         throw std::runtime_error(std::format("Cannot create socket. Error({}): {}", errno, std::strerror(errno)));
     }
 
+    applyOptions(t_logger);
+
     const auto [address, addressLength] = m_endpoint.toSockaddr();
     if (::bind(m_socket, reinterpret_cast<const sockaddr*>(&address), addressLength) < 0) {
         ::close(m_socket);
@@ -53,6 +75,50 @@ auto UdpSocket::bind(core::Logger::LoggerPtr& t_logger) -> void
     ZEPHYR_LOG_INFO(t_logger, "Bound {}", m_endpoint);
 }
 
+auto UdpSocket::applyOptions(core::Logger::LoggerPtr& t_logger) -> void
+{
+    const auto enable = [this](int t_level, int t_name, int t_value) {
+        return setsockopt(m_socket, t_level, t_name, &t_value, sizeof(t_value)) == 0;
+    };
+
+    if (m_options.reusePort && !enable(SOL_SOCKET, SO_REUSEPORT, 1)) {
+        throw std::runtime_error(std::format("Cannot set SO_REUSEPORT. Error({}): {}", errno, std::strerror(errno)));
+    }
+
+    if (m_options.receiveBufferSize > 0 && !enable(SOL_SOCKET, SO_RCVBUF, m_options.receiveBufferSize)) {
+        ZEPHYR_LOG_WARN(t_logger, "Cannot set SO_RCVBUF: {}", std::strerror(errno));
+    }
+    if (m_options.sendBufferSize > 0 && !enable(SOL_SOCKET, SO_SNDBUF, m_options.sendBufferSize)) {
+        ZEPHYR_LOG_WARN(t_logger, "Cannot set SO_SNDBUF: {}", std::strerror(errno));
+    }
+
+    if (m_options.gro && !enable(SOL_UDP, UDP_GRO, 1)) {
+        ZEPHYR_LOG_WARN(t_logger, "UDP_GRO unavailable: {}", std::strerror(errno));
+        m_options.gro = false;
+    }
+
+    // A zero segment size leaves sends untouched and only probes for kernel support
+    if (m_options.gso && !enable(SOL_UDP, UDP_SEGMENT, 0)) {
+        ZEPHYR_LOG_WARN(t_logger, "UDP_SEGMENT unavailable: {}", std::strerror(errno));
+        m_options.gso = false;
+    }
+}
+
+auto UdpSocket::steerByCpu(uint32_t t_groupSize, uint32_t t_firstCpu) -> void
+{
+    std::array<sock_filter, 4> code{{
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_SUB | BPF_K, 0, 0, t_firstCpu},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, t_groupSize},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    }};
+    sock_fprog program{.len = static_cast<unsigned short>(code.size()), .filter = code.data()};
+
+    if (setsockopt(m_socket, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) != 0) {
+        throw std::system_error(errno, std::system_category(), "SO_ATTACH_REUSEPORT_CBPF");
+    }
+}
+
 auto UdpSocket::close() noexcept -> void
 {
     if (m_socket >= 0) {
@@ -60,4 +126,44 @@ auto UdpSocket::close() noexcept -> void
         m_socket = -1;
     }
 }
+
+auto UdpSocket::receiveMessages(std::span<mmsghdr> t_messages) noexcept -> int
+{
+    return ::recvmmsg(m_socket, t_messages.data(), static_cast<unsigned>(t_messages.size()), MSG_DONTWAIT, nullptr);
+}
+
+auto UdpSocket::sendMessages(std::span<mmsghdr> t_messages) noexcept -> int
+{
+    return ::sendmmsg(m_socket, t_messages.data(), static_cast<unsigned>(t_messages.size()), MSG_DONTWAIT);
+}
+
+auto UdpSocket::groSegmentSize(std::span<const std::byte> t_control) noexcept -> std::size_t
+{
+    msghdr message{};
+    message.msg_control = const_cast<std::byte*>(t_control.data());
+    message.msg_controllen = t_control.size();
+
+    for (auto* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+        if (header->cmsg_level == SOL_UDP && header->cmsg_type == UDP_GRO) {
+            int segmentSize = 0;
+            std::memcpy(&segmentSize, CMSG_DATA(header), sizeof(segmentSize));
+            return static_cast<std::size_t>(segmentSize);
+        }
+    }
+
+    return 0;
+}
+
+auto UdpSocket::setGsoSegment(msghdr& t_message, std::span<std::byte> t_control, uint16_t t_segmentSize) noexcept
+    -> void
+{
+    t_message.msg_control = t_control.data();
+    t_message.msg_controllen = GSO_CONTROL_SIZE;
+
+    auto* header = CMSG_FIRSTHDR(&t_message);
+    header->cmsg_level = SOL_UDP;
+    header->cmsg_type = UDP_SEGMENT;
+    header->cmsg_len = CMSG_LEN(sizeof(t_segmentSize));
+    std::memcpy(CMSG_DATA(header), &t_segmentSize, sizeof(t_segmentSize));
+}
 }  // namespace zephyr::network
@@ -0,0 +1,86 @@
+#include "zephyr/plugins/udpServer/details/batch.hpp"
+
+#include "zephyr/network/udpSocket.hpp"
+#include "zephyr/plugins/udpServer/details/protocol.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace zephyr::plugins::udp::details
+{
+auto appendPackets(std::vector<PacketView>& t_packets, std::span<char> t_payload, const sockaddr* t_source,
+                   socklen_t t_sourceLength, std::size_t t_segmentSize) -> void
+{
+    if (t_segmentSize == 0 || t_segmentSize >= t_payload.size()) {
+        t_packets.push_back(PacketView{.payload = t_payload, .source = t_source, .sourceLength = t_sourceLength});
+        return;
+    }
+
+    // Every segment has t_segmentSize bytes except possibly the last one
+    for (std::size_t offset = 0; offset < t_payload.size(); offset += t_segmentSize) {
+        t_packets.push_back(PacketView{
+            .payload = t_payload.subspan(offset, std::min(t_segmentSize, t_payload.size() - offset)),
+            .source = t_source,
+            .sourceLength = t_sourceLength,
+        });
+    }
+}
+
+MessageBatch::MessageBatch(uint32_t t_batchSize, uint32_t t_maxPacketSize, std::size_t t_controlSize)
+    : m_maxPacketSize(t_maxPacketSize),
+      m_controlSize((t_controlSize + sizeof(cmsghdr) - 1) / sizeof(cmsghdr)),
+      m_storage(std::make_unique<char[]>(static_cast<std::size_t>(t_batchSize) * t_maxPacketSize)),
+      m_control(std::make_unique<cmsghdr[]>(t_batchSize * m_controlSize)),
+      m_addresses(t_batchSize),
+      m_vectors(t_batchSize),
+      m_headers(t_batchSize)
+{
+    m_packets.reserve(t_batchSize);
+
+    for (std::size_t i = 0; i < m_headers.size(); ++i) {
+        m_vectors[i] = {.iov_base = m_storage.get() + (i * m_maxPacketSize), .iov_len = m_maxPacketSize};
+        m_headers[i].msg_hdr.msg_iov = &m_vectors[i];
+        m_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+auto MessageBatch::receive(network::UdpSocket& t_socket) -> std::span<PacketView>
+{
+    m_packets.clear();
+
+    // recvmmsg overwrites the name length with the actual one
+    for (std::size_t i = 0; i < m_headers.size(); ++i) {
+        m_headers[i].msg_hdr.msg_name = &m_addresses[i];
+        m_headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        m_headers[i].msg_hdr.msg_control = m_controlSize != 0 ? &m_control[i * m_controlSize] : nullptr;
+        m_headers[i].msg_hdr.msg_controllen = m_controlSize * sizeof(cmsghdr);
+        m_headers[i].msg_hdr.msg_flags = 0;
+    }
+
+    const auto count = t_socket.receiveMessages(m_headers);
+    if (count <= 0) {
+        return {};
+    }
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(count); ++i) {
+        const auto& header = m_headers[i].msg_hdr;
+        if ((header.msg_flags & MSG_TRUNC) != 0) {
+            continue;
+        }
+
+        const auto control = std::span{static_cast<const std::byte*>(header.msg_control), header.msg_controllen};
+        appendPackets(m_packets, {static_cast<char*>(m_vectors[i].iov_base), m_headers[i].msg_len},
+                      reinterpret_cast<const sockaddr*>(&m_addresses[i]), header.msg_namelen,
+                      network::UdpSocket::groSegmentSize(control));
+    }
+
+    return m_packets;
+}
+}  // namespace zephyr::plugins::udp::details
@@ -0,0 +1,173 @@
+#include "zephyr/plugins/udpServer/details/responseSink.hpp"
+
+#include "zephyr/network/udpSocket.hpp"
+#include "zephyr/plugins/udpServer/details/protocol.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace zephyr::plugins::udp
+{
+ResponseSink::ResponseSink(network::UdpSocket& t_socket, std::size_t t_slots, std::size_t t_slotSize)
+    : m_socket(t_socket),
+      m_slotSize(t_slotSize),
+      m_storage(std::make_unique<char[]>(t_slots * t_slotSize)),
+      m_addresses(t_slots),
+      m_vectors(t_slots),
+      m_headers(t_slots),
+      m_gsoHeaders(t_socket.gsoEnabled() ? t_slots : 0),
+      m_gsoControl(t_socket.gsoEnabled() ? t_slots : 0)
+{
+    for (std::size_t i = 0; i < t_slots; ++i) {
+        m_vectors[i].iov_base = m_storage.get() + (i * m_slotSize);
+        m_headers[i].msg_hdr.msg_name = &m_addresses[i];
+        m_headers[i].msg_hdr.msg_iov = &m_vectors[i];
+        m_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+auto ResponseSink::prepare(const PacketView& t_packet) -> std::span<char>
+{
+    if (m_size == m_headers.size()) {
+        flush();
+    }
+
+    const auto length = std::min<socklen_t>(t_packet.sourceLength, sizeof(sockaddr_storage));
+    std::memcpy(&m_addresses[m_size], t_packet.source, length);
+    m_headers[m_size].msg_hdr.msg_namelen = length;
+
+    return {static_cast<char*>(m_vectors[m_size].iov_base), m_slotSize};
+}
+
+auto ResponseSink::commit(std::size_t t_length) -> void
+{
+    m_vectors[m_size].iov_len = std::min(t_length, m_slotSize);
+    ++m_size;
+}
+
+auto ResponseSink::send(const PacketView& t_packet, std::span<const char> t_payload) -> void
+{
+    if (t_payload.size() <= m_slotSize) {
+        auto slot = prepare(t_packet);
+        std::memcpy(slot.data(), t_payload.data(), t_payload.size());
+        commit(t_payload.size());
+        return;
+    }
+
+    iovec vector{.iov_base = const_cast<char*>(t_payload.data()), .iov_len = t_payload.size()};
+    mmsghdr message{};
+    message.msg_hdr.msg_name = const_cast<sockaddr*>(t_packet.source);
+    message.msg_hdr.msg_namelen = t_packet.sourceLength;
+    message.msg_hdr.msg_iov = &vector;
+    message.msg_hdr.msg_iovlen = 1;
+
+    sendMessages(std::span{&message, 1});
+}
+
+auto ResponseSink::flush() -> void
+{
+    const auto count = std::exchange(m_size, 0);
+    if (count == 0) {
+        return;
+    }
+
+    if (m_socket.gsoEnabled()) {
+        flushSegmented(count);
+        return;
+    }
+
+    sendMessages(std::span{m_headers}.first(count));
+}
+
+// The slot iovecs are contiguous, so a run of slots becomes one message; a reply that cannot be
+// merged goes out alone without the cmsg
+auto ResponseSink::flushSegmented(std::size_t t_count) -> void
+{
+    const auto maxSegment = m_socket.maxGsoSegment();
+    std::size_t messages = 0;
+
+    for (std::size_t first = 0; first < t_count;) {
+        const auto segmentSize = m_vectors[first].iov_len;
+        const auto last = first + segmentRun(std::span{m_headers}.subspan(first, t_count - first), maxSegment);
+
+        auto& header = m_gsoHeaders[messages].msg_hdr;
+        header = msghdr{};
+        header.msg_name = &m_addresses[first];
+        header.msg_namelen = m_headers[first].msg_hdr.msg_namelen;
+        header.msg_iov = &m_vectors[first];
+        header.msg_iovlen = last - first;
+
+        if (last - first > 1) {
+            const auto segment = static_cast<uint16_t>(segmentSize);
+            network::UdpSocket::setGsoSegment(header, m_gsoControl[messages].data, segment);
+        }
+
+        ++messages;
+        first = last;
+    }
+
+    sendMessages(std::span{m_gsoHeaders}.first(messages));
+}
+
+// Every segment of a GSO send but the last has to be exactly the segment size, no larger than the
+// MTU allows, and all of them share one destination. An empty reply is never merged: it would add
+// nothing to the send, so the kernel would not emit it.
+auto ResponseSink::segmentRun(std::span<const mmsghdr> t_messages, std::size_t t_maxSegment) noexcept -> std::size_t
+{
+    const auto length = [&t_messages](std::size_t t_index) { return t_messages[t_index].msg_hdr.msg_iov->iov_len; };
+
+    const auto segmentSize = length(0);
+    if (segmentSize == 0 || segmentSize > t_maxSegment) {
+        return 1;
+    }
+
+    auto total = segmentSize;
+    std::size_t count = 1;
+    while (count < t_messages.size() && count < network::UdpSocket::MAX_GSO_SEGMENTS
+           && length(count - 1) == segmentSize && length(count) > 0 && length(count) <= segmentSize
+           && total + length(count) <= network::UdpSocket::MAX_GSO_BYTES
+           && sameDestination(t_messages[0], t_messages[count])) {
+        total += length(count);
+        ++count;
+    }
+
+    return count;
+}
+
+auto ResponseSink::sameDestination(const mmsghdr& t_first, const mmsghdr& t_other) noexcept -> bool
+{
+    const auto length = t_first.msg_hdr.msg_namelen;
+    return t_other.msg_hdr.msg_namelen == length
+           && std::memcmp(t_first.msg_hdr.msg_name, t_other.msg_hdr.msg_name, length) == 0;
+}
+
+// sendmmsg stops at the first message the kernel refuses and only reports that error when it
+// is the first of the call, so a failing message is counted as dropped and skipped, with its
+// replies (one per iovec), and the call resumes after it
+auto ResponseSink::sendMessages(std::span<mmsghdr> t_messages) -> void
+{
+    std::size_t next = 0;
+    while (next < t_messages.size()) {
+        const auto result = m_socket.sendMessages(t_messages.subspan(next));
+        if (result >= 0) {
+            next += static_cast<std::size_t>(result);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+
+        m_dropped += t_messages[next].msg_hdr.msg_iovlen;
+        ++next;
+    }
+}
+}  // namespace zephyr::plugins::udp
@@ -0,0 +1,65 @@
+#include "zephyr/tcp/admissionControl.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace zephyr::tcp
+{
+auto AdmissionControl::admit(std::size_t t_connections, in_addr_t t_source) -> bool
+{
+    if (m_limits.max_connections != 0 && t_connections >= m_limits.max_connections) {
+        return false;
+    }
+
+    if (!tracks_sources()) {
+        return true;
+    }
+
+    auto& count = m_per_source[t_source];
+    if (count >= m_limits.max_connections_per_source) {
+        return false;
+    }
+
+    ++count;
+    return true;
+}
+
+auto AdmissionControl::forget(in_addr_t t_source) -> void
+{
+    if (!tracks_sources()) {
+        return;
+    }
+
+    if (auto found = m_per_source.find(t_source); found != m_per_source.end() && --found->second == 0) {
+        m_per_source.erase(found);
+    }
+}
+
+auto AdmissionControl::update(std::size_t t_connections, std::size_t t_queued) -> AcceptChange
+{
+    if (overloaded(t_connections, t_queued) == m_paused) {
+        return AcceptChange::none;
+    }
+
+    m_paused = !m_paused;
+    return m_paused ? AcceptChange::paused : AcceptChange::resumed;
+}
+
+auto AdmissionControl::connections_from(in_addr_t t_source) const -> std::size_t
+{
+    const auto found = m_per_source.find(t_source);
+    return found == m_per_source.end() ? 0 : found->second;
+}
+
+auto AdmissionControl::overloaded(std::size_t t_connections, std::size_t t_queued) const noexcept -> bool
+{
+    if (m_limits.max_queued_sessions != 0) {
+        const auto limit = m_paused ? m_limits.max_queued_sessions / 2 : m_limits.max_queued_sessions;
+        if (t_queued >= std::max<std::size_t>(limit, 1)) {
+            return true;
+        }
+    }
+
+    return m_limits.max_connections != 0 && t_connections >= m_limits.max_connections;
+}
+}  // namespace zephyr::tcp